@@ -28,10 +28,17 @@
 /* Should include incircle and insphere toexpansionObject:: */
 
 
+#include "cdt_stats.h"
 #include "implicit_point.h"
 
 #pragma intrinsic(fabs)
 
+// Per-mesh supremum of the dynamic error bound computed by orient3d_filtered().
+// When set (see TetMesh::setStaticFilterBounds()), the filter certifies the
+// sign of most determinants with a single comparison. INFINITY disables the
+// pre-stage. Thread local: concurrent threads may process different meshes.
+extern thread_local double o3d_static_filter_bound;
+
 
 inline int orient2d_filtered(double p1x, double p1y, double p2x, double p2y, double p3x, double p3y)
 {
@@ -134,6 +141,12 @@ inline int orient3d_filtered(double px, double py, double pz, double qx, double
 	fadxbdy = fadx * fbdy * fcdz; fbdxady = fbdx * fady * fcdz;
 
 	det = (fbdxcdy - fcdxbdy) + (fcdxady - fadxcdy) + (fadxbdy - fbdxady);
+
+	// Semi-static pre-stage: o3d_static_filter_bound is an upper bound for
+	// the dynamic eb below over all points of the current mesh
+	if (det > o3d_static_filter_bound) return 1;
+	if (-det > o3d_static_filter_bound) return -1;
+
 	eb = 7.7715611723761027e-016 * (fabs(fbdxcdy) + fabs(fcdxbdy) + fabs(fcdxady) + fabs(fadxcdy) + fabs(fadxbdy) + fabs(fbdxady));
 	return ((det >= eb) - (-det >= eb));
 }
@@ -392,8 +405,155 @@ inline int orient3d(double px, double py, double pz, double qx, double qy, doubl
 {
    int ret;
    ret = orient3d_filtered(px, py, pz, qx, qy, qz, rx, ry, rz, sx, sy, sz);
-   if (ret) return ret;
+   if (ret) { CDT_STAT_INC(o3d_filtered); return ret; }
    //ret = orient3d_interval(px, py, pz, qx, qy, qz, rx, ry, rz, sx, sy, sz);
    //if (ret != Filtered_Sign::UNCERTAIN) return ret;
+   CDT_STAT_INC(o3d_exact);
    return orient3d_exact(px, py, pz, qx, qy, qz, rx, ry, rz, sx, sy, sz);
 }
+
+
+/* Batched semi-static filters.
+*
+* During incremental insertion the same point is tested against many
+* tetrahedra in a row. The kernels below evaluate the semi-static filter
+* stage of four such tests per invocation - one per AVX2 lane when AVX2
+* is available. A lane whose sign cannot be guaranteed is set to
+* Filtered_Sign::UNCERTAIN and must be routed to the usual
+* interval/expansion fallback by the caller.
+* Each point is a pointer to its three contiguous coordinates. */
+
+// Defined in indirect_predicates.hpp (included after this file)
+inline int inSphere_filtered(double pax, double pay, double paz, double pbx, double pby, double pbz, double pcx, double pcy, double pcz, double pdx, double pdy, double pdz, double pex, double pey, double pez);
+
+#ifdef USE_AVX2_INSTRUCTIONS
+
+// Load the j'th coordinate of four points into the four lanes of a register
+inline __m256d batch4_coord(const double* const p[4], const int j)
+{
+	return _mm256_set_pd(p[3][j], p[2][j], p[1][j], p[0][j]);
+}
+
+inline __m256d batch4_fabs(const __m256d& x)
+{
+	return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+}
+
+// Lane i receives the sign of orient3d(p[i], q[i], r[i], s),
+// or Filtered_Sign::UNCERTAIN if the filter cannot guarantee it
+inline void orient3d_filtered_batch4(const double* const p[4], const double* const q[4], const double* const r[4], const double* s, int signs[4])
+{
+	const __m256d px = batch4_coord(p, 0), py = batch4_coord(p, 1), pz = batch4_coord(p, 2);
+	const __m256d sx = _mm256_broadcast_sd(s), sy = _mm256_broadcast_sd(s + 1), sz = _mm256_broadcast_sd(s + 2);
+
+	const __m256d fadx = _mm256_sub_pd(batch4_coord(q, 0), px);
+	const __m256d fady = _mm256_sub_pd(batch4_coord(q, 1), py);
+	const __m256d fadz = _mm256_sub_pd(batch4_coord(q, 2), pz);
+	const __m256d fbdx = _mm256_sub_pd(batch4_coord(r, 0), px);
+	const __m256d fbdy = _mm256_sub_pd(batch4_coord(r, 1), py);
+	const __m256d fbdz = _mm256_sub_pd(batch4_coord(r, 2), pz);
+	const __m256d fcdx = _mm256_sub_pd(sx, px);
+	const __m256d fcdy = _mm256_sub_pd(sy, py);
+	const __m256d fcdz = _mm256_sub_pd(sz, pz);
+
+	const __m256d fbdxcdy = _mm256_mul_pd(_mm256_mul_pd(fbdx, fcdy), fadz);
+	const __m256d fcdxbdy = _mm256_mul_pd(_mm256_mul_pd(fcdx, fbdy), fadz);
+	const __m256d fcdxady = _mm256_mul_pd(_mm256_mul_pd(fcdx, fady), fbdz);
+	const __m256d fadxcdy = _mm256_mul_pd(_mm256_mul_pd(fadx, fcdy), fbdz);
+	const __m256d fadxbdy = _mm256_mul_pd(_mm256_mul_pd(fadx, fbdy), fcdz);
+	const __m256d fbdxady = _mm256_mul_pd(_mm256_mul_pd(fbdx, fady), fcdz);
+
+	const __m256d det = _mm256_add_pd(_mm256_add_pd(
+		_mm256_sub_pd(fbdxcdy, fcdxbdy),
+		_mm256_sub_pd(fcdxady, fadxcdy)),
+		_mm256_sub_pd(fadxbdy, fbdxady));
+	const __m256d eb = _mm256_mul_pd(_mm256_set1_pd(7.7715611723761027e-016),
+		_mm256_add_pd(_mm256_add_pd(
+			_mm256_add_pd(batch4_fabs(fbdxcdy), batch4_fabs(fcdxbdy)),
+			_mm256_add_pd(batch4_fabs(fcdxady), batch4_fabs(fadxcdy))),
+			_mm256_add_pd(batch4_fabs(fadxbdy), batch4_fabs(fbdxady))));
+
+	double d[4], e[4];
+	_mm256_storeu_pd(d, det);
+	_mm256_storeu_pd(e, eb);
+	for (int i = 0; i < 4; i++) signs[i] = ((d[i] >= e[i]) - (-d[i] >= e[i]));
+}
+
+// Lane i receives the sign of inSphere(pa[i], pb[i], pc[i], pd[i], pe),
+// or Filtered_Sign::UNCERTAIN if the filter cannot guarantee it
+inline void inSphere_filtered_batch4(const double* const pa[4], const double* const pb[4], const double* const pc[4], const double* const pd[4], const double* pe, int signs[4])
+{
+	const __m256d pex = _mm256_broadcast_sd(pe), pey = _mm256_broadcast_sd(pe + 1), pez = _mm256_broadcast_sd(pe + 2);
+
+	const __m256d aex = _mm256_sub_pd(batch4_coord(pa, 0), pex);
+	const __m256d aey = _mm256_sub_pd(batch4_coord(pa, 1), pey);
+	const __m256d aez = _mm256_sub_pd(batch4_coord(pa, 2), pez);
+	const __m256d bex = _mm256_sub_pd(batch4_coord(pb, 0), pex);
+	const __m256d bey = _mm256_sub_pd(batch4_coord(pb, 1), pey);
+	const __m256d bez = _mm256_sub_pd(batch4_coord(pb, 2), pez);
+	const __m256d cex = _mm256_sub_pd(batch4_coord(pc, 0), pex);
+	const __m256d cey = _mm256_sub_pd(batch4_coord(pc, 1), pey);
+	const __m256d cez = _mm256_sub_pd(batch4_coord(pc, 2), pez);
+	const __m256d dex = _mm256_sub_pd(batch4_coord(pd, 0), pex);
+	const __m256d dey = _mm256_sub_pd(batch4_coord(pd, 1), pey);
+	const __m256d dez = _mm256_sub_pd(batch4_coord(pd, 2), pez);
+
+	const __m256d ab = _mm256_sub_pd(_mm256_mul_pd(aex, bey), _mm256_mul_pd(bex, aey));
+	const __m256d bc = _mm256_sub_pd(_mm256_mul_pd(bex, cey), _mm256_mul_pd(cex, bey));
+	const __m256d cd = _mm256_sub_pd(_mm256_mul_pd(cex, dey), _mm256_mul_pd(dex, cey));
+	const __m256d da = _mm256_sub_pd(_mm256_mul_pd(dex, aey), _mm256_mul_pd(aex, dey));
+	const __m256d ac = _mm256_sub_pd(_mm256_mul_pd(aex, cey), _mm256_mul_pd(cex, aey));
+	const __m256d bd = _mm256_sub_pd(_mm256_mul_pd(bex, dey), _mm256_mul_pd(dex, bey));
+
+	const __m256d abc = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(aez, bc), _mm256_mul_pd(cez, ab)), _mm256_mul_pd(bez, ac));
+	const __m256d bcd = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(bez, cd), _mm256_mul_pd(dez, bc)), _mm256_mul_pd(cez, bd));
+	const __m256d cda = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(cez, da), _mm256_mul_pd(aez, cd)), _mm256_mul_pd(dez, ac));
+	const __m256d dab = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dez, ab), _mm256_mul_pd(bez, da)), _mm256_mul_pd(aez, bd));
+
+	const __m256d alift = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(aex, aex), _mm256_mul_pd(aey, aey)), _mm256_mul_pd(aez, aez));
+	const __m256d blift = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(bex, bex), _mm256_mul_pd(bey, bey)), _mm256_mul_pd(bez, bez));
+	const __m256d clift = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(cex, cex), _mm256_mul_pd(cey, cey)), _mm256_mul_pd(cez, cez));
+	const __m256d dlift = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dex, dex), _mm256_mul_pd(dey, dey)), _mm256_mul_pd(dez, dez));
+
+	const __m256d det = _mm256_add_pd(
+		_mm256_sub_pd(_mm256_mul_pd(clift, dab), _mm256_mul_pd(dlift, abc)),
+		_mm256_sub_pd(_mm256_mul_pd(alift, bcd), _mm256_mul_pd(blift, cda)));
+
+	__m256d max_var = _mm256_max_pd(batch4_fabs(aex), batch4_fabs(aey));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(aez));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(bex));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(bey));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(bez));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(cex));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(cey));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(cez));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(dex));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(dey));
+	max_var = _mm256_max_pd(max_var, batch4_fabs(dez));
+
+	__m256d epsilon = _mm256_mul_pd(max_var, max_var);
+	epsilon = _mm256_mul_pd(epsilon, epsilon);
+	epsilon = _mm256_mul_pd(epsilon, max_var);
+	epsilon = _mm256_mul_pd(epsilon, _mm256_set1_pd(1.145750161413163e-13));
+
+	double d[4], e[4];
+	_mm256_storeu_pd(d, det);
+	_mm256_storeu_pd(e, epsilon);
+	for (int i = 0; i < 4; i++) signs[i] = ((d[i] > e[i]) - (-d[i] > e[i]));
+}
+
+#else
+
+inline void orient3d_filtered_batch4(const double* const p[4], const double* const q[4], const double* const r[4], const double* s, int signs[4])
+{
+	for (int i = 0; i < 4; i++)
+		signs[i] = orient3d_filtered(p[i][0], p[i][1], p[i][2], q[i][0], q[i][1], q[i][2], r[i][0], r[i][1], r[i][2], s[0], s[1], s[2]);
+}
+
+inline void inSphere_filtered_batch4(const double* const pa[4], const double* const pb[4], const double* const pc[4], const double* const pd[4], const double* pe, int signs[4])
+{
+	for (int i = 0; i < 4; i++)
+		signs[i] = inSphere_filtered(pa[i][0], pa[i][1], pa[i][2], pb[i][0], pb[i][1], pb[i][2], pc[i][0], pc[i][1], pc[i][2], pd[i][0], pd[i][1], pd[i][2], pe[0], pe[1], pe[2]);
+}
+
+#endif // USE_AVX2_INSTRUCTIONS
@@ -30,6 +30,7 @@
 
 #include "numerics.h"
 #include <iostream>
+#include <atomic>
 
 // An indirect predicate can assume one of the following values.
 // UNDEFINED means that input parameters are degenerate and do not define an
@@ -66,6 +67,13 @@ protected:
 public:
 	genericPoint(const Point_Type& t) : type(t) {}
 
+	// Dynamically created points are backed by a thread-cached pool
+	// (defined after the point classes below)
+	void* operator new(size_t size);
+	void operator delete(void* p);
+	void* operator new(size_t size, void* p) { return p; } // Placement form
+	void operator delete(void* p, void* q) {}
+
 	Point_Type getType() const { return type; }
 	bool is2D() const { return type <= SSI; }
 	bool is3D() const { return type > SSI; }
@@ -427,6 +435,18 @@ public:
 
 private: // Cached values
 	interval_number dfilter_lambda_x, dfilter_lambda_y, dfilter_lambda_z, dfilter_denominator;
+	// Exact lambdas have at most five components each for this point type
+	// (see lambda3d_LNC_exact()), so the first computation caches them in
+	// full and heavily-encroached Steiner points are not re-expanded at
+	// each inconclusive interval filter.
+	mutable double efilter_lambda_x[5], efilter_lambda_y[5], efilter_lambda_z[5], efilter_lambda_d;
+	mutable int efilter_lambda_x_len, efilter_lambda_y_len, efilter_lambda_z_len;
+	// Publication state of the cache above: 0 = empty, 1 = being written,
+	// 2 = ready. Concurrent walk threads may evaluate predicates on the
+	// same point (parallel location in tetrahedrize()), so the cache must
+	// be release-stored as ready only after all fields are written.
+	mutable std::atomic<int> efilter_lambda_state;
+	bool needsExactLambda() const { return (efilter_lambda_state.load(std::memory_order_acquire) != 2); }
 
 public:
 	bool getIntervalLambda(interval_number& lx, interval_number& ly, interval_number& lz, interval_number& d) const;
@@ -436,6 +456,34 @@ public:
 };
 
 
+//////////////////////////////////////////////////////////////////////////////////////
+//
+// POINT ALLOCATION
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+// Points created and destroyed in large numbers (e.g. LNC Steiner points during
+// segment recovery) are backed by a thread-cached lock-free pool rather than by
+// the system allocator. All point types share one pool whose block hosts the
+// largest of them, so a deletion through a genericPoint pointer pairs with the
+// same pool regardless of the dynamic type of the point.
+
+constexpr size_t largest_point_size() {
+	size_t s = sizeof(explicitPoint2D);
+	if (sizeof(implicitPoint2D_SSI) > s) s = sizeof(implicitPoint2D_SSI);
+	if (sizeof(explicitPoint3D) > s) s = sizeof(explicitPoint3D);
+	if (sizeof(implicitPoint3D_LPI) > s) s = sizeof(implicitPoint3D_LPI);
+	if (sizeof(implicitPoint3D_TPI) > s) s = sizeof(implicitPoint3D_TPI);
+	if (sizeof(implicitPoint3D_LNC) > s) s = sizeof(implicitPoint3D_LNC);
+	return s;
+}
+
+typedef TC_memory_pool<largest_point_size()> pointMemoryPool;
+
+inline void* genericPoint::operator new(size_t size) { return pointMemoryPool::alloc(); }
+inline void genericPoint::operator delete(void* p) { pointMemoryPool::release(p); }
+
+
 //////////////////////////////////////////////////////////////////////////////////////
 //
 // OUTPUT TO STD STREAMS
@@ -628,7 +628,8 @@ inline bool implicitPoint3D_LNC::getIntervalLambda(interval_number& lx, interval
 
 inline implicitPoint3D_LNC::implicitPoint3D_LNC(const explicitPoint3D& _p, const explicitPoint3D& _q,
 	const double _t)
-	: genericPoint(Point_Type::LNC), ip(_p), iq(_q), t(_t)
+	: genericPoint(Point_Type::LNC), ip(_p), iq(_q), t(_t),
+	efilter_lambda_state(0)
 {
 	lambda3d_LNC_interval(P().X(), P().Y(), P().Z(), Q().X(), Q().Y(), Q().Z(), T(), dfilter_lambda_x, dfilter_lambda_y, dfilter_lambda_z, dfilter_denominator);
 }
@@ -694,8 +695,29 @@ inline void implicitPoint3D_TPI::getExactLambda(double **lx, int& lxl, double **
 
 inline void implicitPoint3D_LNC::getExactLambda(double** lx, int& lxl, double** ly, int& lyl, double** lz, int& lzl, double** d, int& dl) const
 {
-	lambda3d_LNC_exact(P().X(), P().Y(), P().Z(), Q().X(), Q().Y(), Q().Z(), T(), lx, lxl, ly, lyl, lz, lzl, d, dl);
-	normalizeLambda3D(*lx, lxl, *ly, lyl, *lz, lzl, *d, dl);
+	if (needsExactLambda()) {
+		int expected = 0;
+		if (efilter_lambda_state.compare_exchange_strong(expected, 1, std::memory_order_relaxed)) {
+			// First computation: fill the cache, then publish it
+			// (see implicit_point.h)
+			double* cx = efilter_lambda_x, * cy = efilter_lambda_y, * cz = efilter_lambda_z, * cd = &efilter_lambda_d;
+			int cdl;
+			lambda3d_LNC_exact(P().X(), P().Y(), P().Z(), Q().X(), Q().Y(), Q().Z(), T(), &cx, efilter_lambda_x_len, &cy, efilter_lambda_y_len, &cz, efilter_lambda_z_len, &cd, cdl);
+			normalizeLambda3D(cx, efilter_lambda_x_len, cy, efilter_lambda_y_len, cz, efilter_lambda_z_len, cd, cdl);
+			efilter_lambda_state.store(2, std::memory_order_release);
+		}
+		else if (needsExactLambda()) {
+			// Another thread is still writing the cache: compute into the
+			// caller's buffers rather than waiting for it
+			lambda3d_LNC_exact(P().X(), P().Y(), P().Z(), Q().X(), Q().Y(), Q().Z(), T(), lx, lxl, ly, lyl, lz, lzl, d, dl);
+			normalizeLambda3D(*lx, lxl, *ly, lyl, *lz, lzl, *d, dl);
+			return;
+		}
+	}
+	lxl = efilter_lambda_x_len; memcpy(*lx, efilter_lambda_x, lxl * sizeof(double));
+	lyl = efilter_lambda_y_len; memcpy(*ly, efilter_lambda_y, lyl * sizeof(double));
+	lzl = efilter_lambda_z_len; memcpy(*lz, efilter_lambda_z, lzl * sizeof(double));
+	dl = 1; (*d)[0] = efilter_lambda_d; // The denominator has a single component
 }
 
 inline void implicitPoint2D_SSI::getBigfloatLambda(bigfloat& lx, bigfloat& ly, bigfloat& d) const
@@ -914,6 +936,20 @@ inline bool implicitPoint3D_TPI::getExactXYZCoordinates(bigrational& x, bigratio
 
 inline bool implicitPoint3D_LNC::getExactXYZCoordinates(bigrational& x, bigrational& y, bigrational& z) const
 {
+	if (!needsExactLambda()) {
+		// The expansions cached by getExactLambda() are exact: summing their
+		// components and dividing by the common denominator avoids re-deriving
+		// the lambdas of points that were already expanded during recovery.
+		bigfloat lx, ly, lz;
+		for (int i = 0; i < efilter_lambda_x_len; i++) lx = lx + bigfloat(efilter_lambda_x[i]);
+		for (int i = 0; i < efilter_lambda_y_len; i++) ly = ly + bigfloat(efilter_lambda_y[i]);
+		for (int i = 0; i < efilter_lambda_z_len; i++) lz = lz + bigfloat(efilter_lambda_z[i]);
+		const bigrational rd((bigfloat(efilter_lambda_d)));
+		x = bigrational(lx) / rd;
+		y = bigrational(ly) / rd;
+		z = bigrational(lz) / rd;
+		return true;
+	}
 	bigfloat lx, ly, lz, d;
 	getBigfloatLambda(lx, ly, lz, d);
 	x = bigrational(lx);
@@ -28,10 +28,17 @@
 /* This code was generated automatically. Do not edit unless you exactly   */
 /* know what you are doing!                                                */
 
+#include "cdt_stats.h"
 #include "implicit_point.h"
 
 #pragma intrinsic(fabs)
 
+// Per-mesh supremum of the dynamic error bound computed by inSphere_filtered().
+// When set (see TetMesh::setStaticFilterBounds()), the filter certifies the
+// sign of most determinants with a single comparison. INFINITY disables the
+// pre-stage. Thread local: concurrent threads may process different meshes.
+extern thread_local double isp_static_filter_bound;
+
 // Uncomment the following to activate overflow/underflow checks
 #ifndef __EMSCRIPTEN__
 #define CHECK_FOR_XYZERFLOWS
@@ -524,6 +531,11 @@ inline int inSphere_filtered(double pax, double pay, double paz, double pbx, dou
    const double dr = dr2 - dr1;
    const double det = dl + dr;
 
+   // Semi-static pre-stage: isp_static_filter_bound is an upper bound for
+   // the dynamic epsilon below over all points of the current mesh
+   if (det > isp_static_filter_bound) return IP_Sign::POSITIVE;
+   if (-det > isp_static_filter_bound) return IP_Sign::NEGATIVE;
+
    double _tmp_fabs;
 
    double max_var = 0.0;
@@ -914,9 +926,10 @@ inline int inSphere(double pax, double pay, double paz, double pbx, double pby,
 {
    int ret;
    ret = inSphere_filtered(pax, pay, paz, pbx, pby, pbz, pcx, pcy, pcz, pdx, pdy, pdz, pex, pey, pez);
-   if (ret != Filtered_Sign::UNCERTAIN) return ret;
+   if (ret != Filtered_Sign::UNCERTAIN) { CDT_STAT_INC(isp_filtered); return ret; }
    ret = inSphere_interval(pax, pay, paz, pbx, pby, pbz, pcx, pcy, pcz, pdx, pdy, pdz, pex, pey, pez);
-   if (ret != Filtered_Sign::UNCERTAIN) return ret;
+   if (ret != Filtered_Sign::UNCERTAIN) { CDT_STAT_INC(isp_interval); return ret; }
+   CDT_STAT_INC(isp_exact);
    return inSphere_exact(pax, pay, paz, pbx, pby, pbz, pcx, pcy, pcz, pdx, pdy, pdz, pex, pey, pez);
 }
 
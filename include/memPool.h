@@ -32,6 +32,7 @@
 #include <bit>
 #include <bitset>
 #include <cstdint>
+#include <atomic>
 
 // An N_block is a contiguous portion of memory elements.
 // An N_memory_pool stores a set of N_blocks along with
@@ -248,4 +249,78 @@ public:
 	}
 };
 
+// A TC_memory_pool ("thread-cached") hands out fixed-size blocks from
+// per-thread caches, hence concurrent allocation needs no synchronization.
+// release() may be called from any thread: blocks go back to the caller's
+// own cache, and only the excess beyond a cap is pushed on a global
+// lock-free stack, which caches drain when they run dry.
+// All storage is carved from large slabs that are never relocated.
+//
+// alloc and release are O(1); the only shared state is the reclaim
+// stack, touched with one CAS per spilled block or adopted chain.
+
+template <size_t block_size>
+class TC_memory_pool {
+	static constexpr size_t SLAB_BLOCKS = 1024; // Blocks carved per slab
+	static constexpr size_t MAX_CACHED = 4096;  // Cached blocks per thread before spilling
+	static constexpr size_t BS = (block_size + 15) & ~((size_t)15); // Keep blocks 16-byte aligned
+
+	inline static std::atomic<void*> reclaimed{ nullptr }; // Free blocks spilled by any thread
+	inline static std::atomic<void*> slabs{ nullptr }; // All slabs, chained by their first word
+
+	// Blocks cached by one thread; given back to the reclaim stack at thread exit
+	struct localCache {
+		std::vector<void*> blocks;
+		~localCache() { for (void* p : blocks) pushReclaimed(p); }
+	};
+
+	static localCache& cache() {
+		static thread_local localCache c;
+		return c;
+	}
+
+	static void pushReclaimed(void* p) {
+		void* head = reclaimed.load(std::memory_order_relaxed);
+		do { *(void**)p = head; } while (!reclaimed.compare_exchange_weak(head, p, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	static void refill(std::vector<void*>& blocks) {
+		// First adopt whatever other threads have spilled
+		void* chain = reclaimed.exchange(nullptr, std::memory_order_acquire);
+		while (chain) { blocks.push_back(chain); chain = *(void**)chain; }
+		if (!blocks.empty()) return;
+
+		// Nothing to reuse: carve a new slab (16 bytes reserved for the chain word)
+		uint8_t* slab = (uint8_t*)malloc(16 + BS * SLAB_BLOCKS);
+		void* head = slabs.load(std::memory_order_relaxed);
+		do { *(void**)slab = head; } while (!slabs.compare_exchange_weak(head, slab, std::memory_order_release, std::memory_order_relaxed));
+		uint8_t* b = slab + 16;
+		for (size_t i = 0; i < SLAB_BLOCKS; i++, b += BS) blocks.push_back(b);
+	}
+
+	// Frees the slabs when the program exits
+	struct slabFlusher {
+		~slabFlusher() {
+			void* s = slabs.exchange(nullptr, std::memory_order_acquire);
+			while (s) { void* n = *(void**)s; free(s); s = n; }
+		}
+	};
+	inline static slabFlusher slab_flusher;
+
+public:
+	static void* alloc() {
+		std::vector<void*>& blocks = cache().blocks;
+		if (blocks.empty()) refill(blocks);
+		void* p = blocks.back();
+		blocks.pop_back();
+		return p;
+	}
+
+	static void release(void* p) {
+		std::vector<void*>& blocks = cache().blocks;
+		if (blocks.size() >= MAX_CACHED) pushReclaimed(p);
+		else blocks.push_back(p);
+	}
+};
+
 #endif //MEMPOOL_H
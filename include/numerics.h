@@ -533,7 +533,11 @@ inline void setFPUModeToRoundNEAR() {
 
 	// Preallocates memory for bignaturals having at most 32 limbs.
 	// Larger numbers will use the standard heap.
-	inline static thread_local MultiPool nfgMemoryPool;
+	// Must not be 'static': with internal linkage each translation unit gets
+	// its own pool, and the deduplicated inline bignatural functions end up
+	// releasing blocks into a different instance than the one that allocated
+	// them, corrupting the free stacks.
+	inline thread_local MultiPool nfgMemoryPool;
 
 	// A bignatural is an arbitrarily large non-negative integer.
 	// It is made of a sequence of digits in base 2^32.
@@ -515,14 +515,34 @@ inline int expansionObject::Gen_Diff(const int elen, const double* e, const int
 inline int expansionObject::Gen_Scale(const int elen, const double* e, const double b, double* h)
 {
 	double Q, sum, hh, pr1, pr0;
-	const double* ei = e, * elast = e + elen;
 
 	int k = 0;
-	Two_Prod(*ei, b, Q, hh);
+	Two_Prod(e[0], b, Q, hh);
 	if (hh != 0) h[k++] = hh;
 
-	while (++ei < elast) {
-		Two_Prod(*ei, b, pr1, pr0);
+	int i = 1;
+#ifdef USE_AVX2_INSTRUCTIONS
+	// The products e[i]*b are independent of the carry chain: evaluate
+	// their error-free transformations four at a time with FMA and feed
+	// the precomputed pairs to the chain. Each pair is bitwise identical
+	// to the scalar Two_Prod output, hence so is the resulting expansion.
+	const __m256d b4 = _mm256_set1_pd(b);
+	for (; i + 4 <= elen; i += 4) {
+		double vpr1[4], vpr0[4];
+		const __m256d e4 = _mm256_loadu_pd(e + i);
+		const __m256d x4 = _mm256_mul_pd(e4, b4);
+		_mm256_storeu_pd(vpr1, x4);
+		_mm256_storeu_pd(vpr0, _mm256_fmsub_pd(e4, b4, x4));
+		for (int j = 0; j < 4; j++) {
+			Two_Sum(Q, vpr0[j], sum, hh);
+			if (hh != 0) h[k++] = hh;
+			Quick_Two_Sum(vpr1[j], sum, Q, hh);
+			if (hh != 0) h[k++] = hh;
+		}
+	}
+#endif
+	for (; i < elen; i++) {
+		Two_Prod(e[i], b, pr1, pr0);
 		Two_Sum(Q, pr0, sum, hh);
 		if (hh != 0) h[k++] = hh;
 		Quick_Two_Sum(pr1, sum, Q, hh);
@@ -1070,7 +1090,9 @@ inline void bignatural::addmul(uint32_t b, uint32_t left_shifts, bignatural& res
 inline void bignatural::increaseCapacity(uint32_t new_capacity) {
 	m_capacity = new_capacity;
 	uint32_t *tmp_d = (uint32_t*)BN_ALLOC(sizeof(uint32_t) * m_capacity);
-	memcpy(tmp_d, digits, sizeof(uint32_t) * m_size);
+	// The null check matters: memcpy(_, NULL, 0) is undefined and lets the
+	// optimizer assume 'digits' is non-null, breaking the check in BN_FREE
+	if (m_size) memcpy(tmp_d, digits, sizeof(uint32_t) * m_size);
 	BN_FREE(digits);
 	digits = tmp_d;
 }
@@ -4,6 +4,7 @@
 #include <random>
 #include <algorithm>
 #include <set>
+#include <thread>
 
 #ifdef USE_INDIRECT_PREDS
 double PLCx::getT1(uint32_t oe0i, uint32_t e0i) const {
@@ -366,26 +367,23 @@ void PLCx::makeVertexTriangleMap(PLCface& f, std::vector<std::vector<uint32_t>>&
     singular_v.clear();
 }
 
-// Removes duplicated pre-PLCedges
-void PLCx::mergePreEdges(){
-
-  // sort edges by lexicografic non-descending endpoints
-  std::sort(edges.begin(), edges.end(), PLCedge::vertexSortFunc);
-
-  for(uint32_t ei=0; ei < edges.size()-1; ){
-    PLCedge& e = edges[ei];
-
-    while( ++ei < edges.size() && e.ep[0]==edges[ei].ep[0] && e.ep[1] == edges[ei].ep[1]){
-      PLCedge& ne = edges[ei];
-      // each edge initially has only one incident triangle, ne never been merged
-      e.inc_tri.push_back( ne.inc_tri[0] );
-      ne.inc_tri.clear(); // ne is now isolated
-    }
-
+// Merges duplicated pre-edges into the PLCedge vector.
+// Pre-edges are (packed endpoint pair, incident triangle) records: sorting
+// these 12-byte PODs costs a fraction of sorting whole PLCedges, and only
+// the merged edges materialize an inc_tri vector.
+void PLCx::mergePreEdges(std::vector<std::pair<uint64_t, uint32_t>>& pre_edges){
+
+  // sort by lexicografic non-descending endpoints, then by triangle
+  std::sort(pre_edges.begin(), pre_edges.end());
+
+  for (size_t i = 0; i < pre_edges.size(); ) {
+    const uint64_t key = pre_edges[i].first;
+    edges.emplace_back();
+    PLCedge& e = edges.back();
+    e.fill_preEdge((uint32_t)(key >> 32), (uint32_t)key, pre_edges[i].second);
+    while (++i < pre_edges.size() && pre_edges[i].first == key)
+      e.inc_tri.push_back(pre_edges[i].second);
   }
-
-  // remove duplicated edges (no inc_faces) from edges vectcor
-  edges.erase(std::remove_if(edges.begin(), edges.end(), PLCedge::isIsolatedPtr), edges.end());
 }
 
 // Assumes that the PLCedge e is one of the sides of the input-triangle ti.
@@ -421,21 +419,24 @@ void PLCx::initialize(){
   std::vector<bool> is_acute(delmesh.numVertices(), false);
 
   // -- Fill edges --
-  edges.resize(input_nt * 3); // More than necessary, will be merged later
-
-  // Fill only EV and partial ET relations
+  // Three pre-edges per triangle, as (packed endpoint pair, triangle) records
+  const auto packEdge = [](uint32_t v0, uint32_t v1) {
+      if (v0 > v1) std::swap(v0, v1);
+      return ((uint64_t)v0 << 32) | v1;
+  };
+  std::vector<std::pair<uint64_t, uint32_t>> pre_edges(input_nt * 3);
   for(uint32_t ti=0; ti<input_nt; ti++){
     const uint32_t ei = 3*ti;
     const uint32_t v0 = input_tv[ei];
     const uint32_t v1 = input_tv[ei+1];
     const uint32_t v2 = input_tv[ei+2];
-    edges[ei].fill_preEdge(v0,v1,ti);
-    edges[ei+1].fill_preEdge(v1,v2,ti);
-    edges[ei+2].fill_preEdge(v2,v0,ti);
+    pre_edges[ei] = { packEdge(v0, v1), ti };
+    pre_edges[ei+1] = { packEdge(v1, v2), ti };
+    pre_edges[ei+2] = { packEdge(v2, v0), ti };
   }
 
   // merge duplicated pre-edges
-  mergePreEdges(); // Now edges contains proper edges.
+  mergePreEdges(pre_edges); // Now edges contains proper edges.
 
   // Mark flat edges and fill vv (only for non-flat edges)
   std::vector<std::vector<uint32_t>> vv; // vv relation relative to PLC
@@ -513,10 +514,40 @@ bool PLCx::is_missing_PLCedge(const uint32_t ei) const{
 // Find all missing edges (i.e. non-flat PLCedges that are not a side of some
 // tetrahedron of delmesh) and add their indices to vector me.
 void PLCx::find_missing_PLCedges(std::vector<uint32_t>& me) const {
-    for (uint32_t ei = 0; ei < edges.size(); ei++) {
-        const PLCedge& e = edges[ei];
-        if (e.type != flat && is_missing_PLCedge(ei)) me.push_back(ei);
-  }
+    std::vector<uint32_t> candidates;
+    for (uint32_t ei = 0; ei < edges.size(); ei++)
+        if (edges[ei].type != flat) candidates.push_back(ei);
+    collectMissingEdges(candidates, me);
+}
+
+// Append to 'me' the candidate edges that are still missing. The queries
+// are read-only and independent of each other: when there are enough of
+// them they are distributed over all cores. Results keep the order of
+// 'candidates', so the outcome does not depend on the number of threads.
+void PLCx::collectMissingEdges(const std::vector<uint32_t>& candidates, std::vector<uint32_t>& me) const {
+    const unsigned int num_threads = std::thread::hardware_concurrency();
+    if (num_threads <= 1 || candidates.size() < PAR_EDGE_RESCAN_MIN_EDGES) {
+        for (const uint32_t ei : candidates) if (is_missing_PLCedge(ei)) me.push_back(ei);
+        return;
+    }
+
+    std::vector<uint8_t> missing(candidates.size(), 0);
+    const uint32_t* cd = candidates.data();
+    uint8_t* md = missing.data();
+    std::vector<std::thread> workers;
+    const size_t chunk = candidates.size() / num_threads + 1;
+    const auto scanRange = [this, cd, md](size_t b, size_t e) {
+        for (size_t i = b; i < e; i++)
+            md[i] = !delmesh.hasEdgeThreadSafe(edges[cd[i]].ep[0], edges[cd[i]].ep[1]);
+    };
+    for (unsigned int w = 1; w < num_threads; w++) {
+        const size_t b = std::min(w * chunk, candidates.size()), e = std::min(b + chunk, candidates.size());
+        workers.emplace_back(scanRange, b, e);
+    }
+    scanRange(0, std::min(chunk, candidates.size()));
+    for (std::thread& w : workers) w.join();
+
+    for (size_t i = 0; i < candidates.size(); i++) if (missing[i]) me.push_back(cd[i]);
 }
 
 
@@ -626,15 +657,28 @@ bool PLCx::splitMissingEdge(uint32_t mei) {
     }
 
     // 2-UPDATE TetMesh by tetrahedralizing around steiner_point (last elem of vertices)
-    delmesh.insertExistingVertex((uint32_t)delmesh.vertices.size() - 1, ct);
+    // The tet found above may be far from the Steiner point: let the locator
+    // grid provide a closer starting tet for the insertion walk, if it can.
+    const uint32_t spi = (uint32_t)delmesh.vertices.size() - 1;
+    const uint64_t gt = delmesh.getApproximateStartingTet(spi);
+    if (gt != UINT64_MAX) ct = gt;
+    delmesh.insertExistingVertex(spi, ct);
 
     return true;
 }
 
+static thread_local int myrand_h = 1;
+
 int myrand(void)
 {
-    static int h = 1;
-    return(((h = h * 214013L + 2531011L) >> 16) & 0x7fff);
+    return(((myrand_h = myrand_h * 214013L + 2531011L) >> 16) & 0x7fff);
+}
+
+// Reset the generator so that results do not depend on whatever the
+// current thread processed before (e.g. earlier files in a batch run).
+void myrand_reset(void)
+{
+    myrand_h = 1;
 }
 
 template< class T > void shuffle_vec(T first, T last)
@@ -647,6 +691,8 @@ template< class T > void shuffle_vec(T first, T last)
 //// 
 void PLCx::segmentRecovery_HSi(bool quiet)
 {
+    myrand_reset();
+
     for (uint64_t tet_i = 0; tet_i < delmesh.numTets(); tet_i++)
         delmesh.unmark_Tet_1(tet_i);
 
@@ -656,7 +702,7 @@ void PLCx::segmentRecovery_HSi(bool quiet)
 
     // If edge was not touched by the insertion, no need to check if it is missing
     std::vector<bool> touched_vertex(delmesh.vertices.size(), false);
-    std::vector<uint32_t> loval_vv;
+    std::vector<uint32_t> loval_vv, rescan_candidates;
     size_t num_st = 0;
 
     // Main loop
@@ -683,10 +729,12 @@ void PLCx::segmentRecovery_HSi(bool quiet)
             }
         }
 
+        rescan_candidates.clear();
         for (uint32_t ei = 0; ei < edges.size(); ei++) {
             const PLCedge& e = edges[ei];
-            if (e.type != flat && (touched_vertex[e.ep[0]] && touched_vertex[e.ep[1]]) && is_missing_PLCedge(ei)) miss_edges.push_back(ei);
+            if (e.type != flat && (touched_vertex[e.ep[0]] && touched_vertex[e.ep[1]])) rescan_candidates.push_back(ei);
         }
+        collectMissingEdges(rescan_candidates, miss_edges);
         for (uint32_t i = 0; i < delmesh.numVertices(); i++) touched_vertex[i] = 0;
         
         shuffle_vec(miss_edges.begin(), miss_edges.end());
@@ -915,6 +963,9 @@ void PLCx::makePLCfaces() {
     // For each face, for each of its vertices, set of incident face triangles
     makeVertexTriangleMaps(vt_maps);
     v_reindex.resize(delmesh.vertices.size());
+
+    // Size the persistent orientation cache for the recovery that follows
+    o3d_memo.init(delmesh.vertices.size());
 }
 
 
@@ -1008,15 +1059,23 @@ bool PLCx::adjacentFaceVertices(uint32_t v1, uint32_t v2, const PLCface& f) {
     return (id == 1 || id == (f.vertices.size()-1));
 }
 
+int PLCx::memoizedOrient3D(uint32_t v, uint32_t v1, uint32_t v2, uint32_t v3) {
+    int s;
+    if (o3d_memo.get(v, v1, v2, v3, s)) return s;
+    s = delmesh.vOrient3D(v, v1, v2, v3);
+    o3d_memo.put(v, v1, v2, v3, s);
+    return s;
+}
+
 int PLCx::localOrient3d(uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, std::vector<uint32_t>& to_unorient) {
     if (v_orient[v1] != UNDET_ORIENTATION) return v_orient[v1];
     to_unorient.push_back(v1);
-    return (v_orient[v1] = delmesh.vOrient3D(v1, v2, v3, v4));
+    return (v_orient[v1] = memoizedOrient3D(v1, v2, v3, v4));
 }
 
 int PLCx::cachedOrient3D(uint32_t v, uint32_t v1, uint32_t v2, uint32_t v3) {
     if (v_orient[v] == UNDET_ORIENTATION)
-        v_orient[v] = delmesh.vOrient3D(v, v1, v2, v3);
+        v_orient[v] = memoizedOrient3D(v, v1, v2, v3);
     return v_orient[v];
 }
 
@@ -1033,7 +1092,8 @@ void PLCx::getTetsIntersectingFace(uint32_t fi, std::vector<uint64_t> *i_tets, s
     const PLCedge* e0 = f.bounding_edges.front();
     v_t[0] = e0->ep[0]; v_t[1] = e0->ep[1];
 
-    std::vector<uint64_t> et;
+    static thread_local std::vector<uint64_t> et; // Static to avoid reallocation at each call
+    et.clear();
     delmesh.ET(v_t[0], v_t[1], et);
 
     const uint32_t *tv = input_tv + f.triangles[0] * 3; // Vertices of one face triangle for orientation
@@ -1069,7 +1129,8 @@ void PLCx::getTetsIntersectingFace(uint32_t fi, std::vector<uint64_t> *i_tets, s
     // Flat orig edges in f
     const std::vector<std::pair<uint32_t, uint32_t>>& orig_flat_edges = f.orig_flat_edges;
 
-    std::vector<uint32_t> to_unorient;
+    static thread_local std::vector<uint32_t> to_unorient; // Static to avoid reallocation at each call
+    to_unorient.clear();
 
     //  Find a tet t0 in ET(e) intersecting the face interior
     uint64_t t0 = UINT64_MAX;
@@ -1114,7 +1175,8 @@ void PLCx::getTetsIntersectingFace(uint32_t fi, std::vector<uint64_t> *i_tets, s
     }
 
     // B = empty
-    std::vector<uint64_t> B;
+    static thread_local std::vector<uint64_t> B; // Static to avoid reallocation at each call
+    B.clear();
 
     // Mark t0 and insert in B
     if (t0!=UINT64_MAX) B.push_back(t0);
@@ -1125,13 +1187,63 @@ void PLCx::getTetsIntersectingFace(uint32_t fi, std::vector<uint64_t> *i_tets, s
     }
     else delmesh.mark_Tet_1(t0);
 
+    // The classification below needs the exact orientation of each vertex
+    // it meets wrt the face plane. Those predicates dominate the traversal
+    // on faces with large intersected regions, but they are independent of
+    // each other: when a front is large enough, the orientations it needs
+    // are resolved in parallel into the lock-free memo beforehand, so the
+    // sequential visit that follows stays unchanged and deterministic.
+    const unsigned int num_threads = std::thread::hardware_concurrency();
+    static thread_local std::vector<uint32_t> warm; // Static to avoid reallocation at each call
+
+    const auto resolveInParallel = [&]() {
+        std::sort(warm.begin(), warm.end());
+        warm.erase(std::unique(warm.begin(), warm.end()), warm.end());
+        if (warm.size() < num_threads) {
+            for (const uint32_t v : warm) memoizedOrient3D(v, tv[0], tv[1], tv[2]);
+            return;
+        }
+        std::vector<std::thread> workers;
+        const uint32_t* wdata = warm.data(); // 'warm' is thread_local: workers get an explicit pointer
+        const size_t chunk = warm.size() / num_threads + 1;
+        for (unsigned int w = 1; w < num_threads; w++) {
+            const size_t b = std::min(w * chunk, warm.size()), e = std::min(b + chunk, warm.size());
+            workers.emplace_back([this, b, e, wdata, tv]() {
+                initFPU();
+                for (size_t i = b; i < e; i++) memoizedOrient3D(wdata[i], tv[0], tv[1], tv[2]);
+            });
+        }
+        for (size_t i = 0; i < std::min(chunk, warm.size()); i++) memoizedOrient3D(wdata[i], tv[0], tv[1], tv[2]);
+        for (std::thread& w : workers) w.join();
+    };
+
     // In the remainder, OK means "add n to B, mark it"
-    // for each tet t in B
-    //int ct = 0;
-    for (size_t k = 0; k < B.size(); k++) {
+    // for each tet t in B, one front layer at a time
+    size_t layer_begin = 0;
+    while (layer_begin < B.size()) {
+    const size_t layer_end = B.size();
+
+    if (num_threads > 1 && layer_end - layer_begin >= PAR_FACE_FRONT_MIN_TETS) {
+        warm.clear();
+        for (size_t k = layer_begin; k < layer_end; k++) {
+            const corner_t* nn = delmesh.tet_neigh.data() + (B[k] << 2);
+            for (int i = 0; i < 4; i++) {
+                const uint64_t n = nn[i] >> 2;
+                if (delmesh.isGhost(n) || delmesh.is_marked_Tet_1(n)) continue;
+                const uint32_t* tn = delmesh.tet_node.data() + (B[k] << 2);
+                for (int j = 1; j < 4; j++) {
+                    const uint32_t cv = tn[(i + j) & 3];
+                    if (v_orient[cv] == UNDET_ORIENTATION) warm.push_back(cv);
+                }
+            }
+        }
+        resolveInParallel();
+    }
+
+    for (size_t k = layer_begin; k < layer_end; k++) {
         const uint64_t t = B[k];
         const uint64_t tb = t << 2;
-        const uint64_t* nn = delmesh.tet_neigh.data() + tb;
+        const corner_t* nn = delmesh.tet_neigh.data() + tb;
         const uint32_t* tn = delmesh.tet_node.data() + tb;
         // for each of the four neighbors n of t
         for (int i = 0; i < 4; i++) {
@@ -1174,6 +1286,19 @@ void PLCx::getTetsIntersectingFace(uint32_t fi, std::vector<uint64_t> *i_tets, s
             }
         }
     }
+    layer_begin = layer_end;
+    }
+
+    // Same parallel resolution for the final per-tet classification
+    if (num_threads > 1 && B.size() >= PAR_FACE_FRONT_MIN_TETS) {
+        warm.clear();
+        for (const uint64_t t : B) {
+            const uint32_t* n = delmesh.tet_node.data() + (t << 2);
+            for (int i = 0; i < 4; i++)
+                if (v_orient[n[i]] == UNDET_ORIENTATION) warm.push_back(n[i]);
+        }
+        resolveInParallel();
+    }
 
     for (uint64_t t : B) {
         delmesh.unmark_Tet_1(t);
@@ -1370,6 +1495,38 @@ size_t PLCx::markInnerTets() {
     return delmesh.markInnerTets(cornerMask);
 }
 
+// Axis-aligned boxes used to confine the recursion passes of faceRecovery().
+// A box is six doubles: {minx, miny, minz, maxx, maxy, maxz}.
+
+static void initBox(double* b) {
+    b[0] = b[1] = b[2] = DBL_MAX;
+    b[3] = b[4] = b[5] = -DBL_MAX;
+}
+
+static void addPointToBox(const pointType* p, double* b) {
+    const vector3d v(p);
+    for (int i = 0; i < 3; i++) {
+        if (v.c[i] < b[i]) b[i] = v.c[i];
+        if (v.c[i] > b[i + 3]) b[i + 3] = v.c[i];
+    }
+}
+
+// Conservatively compensate the roundoff of the approximate positions
+// used to build the box (relevant for implicit Steiner points)
+static void inflateBox(double* b) {
+    for (int i = 0; i < 3; i++) {
+        const double d = (fabs(b[i]) + fabs(b[i + 3])) * 1.0e-10;
+        b[i] -= d;
+        b[i + 3] += d;
+    }
+}
+
+static bool boxesOverlap(const double* a, const double* b) {
+    return a[0] <= b[3] && b[0] <= a[3] &&
+           a[1] <= b[4] && b[1] <= a[4] &&
+           a[2] <= b[5] && b[2] <= a[5];
+}
+
 bool PLCx::faceRecovery(bool quiet) {
     makePLCfaces();
 
@@ -1378,11 +1535,31 @@ bool PLCx::faceRecovery(bool quiet) {
     delmesh.marked_vertex.assign(delmesh.vertices.size(), 0);
     for (uint64_t tet_i = 0; tet_i < delmesh.numTets(); tet_i++) delmesh.unmark_Tet_1(tet_i);
 
+    // Approximate bounding box of each face. A recovery alters the mesh only
+    // within the hull of its cavity vertices, hence a recursion pass needs to
+    // re-examine only the faces whose box overlaps an altered region; the
+    // others (the overwhelming majority) are skipped.
+    std::vector<double> face_box(faces.size() * 6);
+    for (size_t i = 0; i < faces.size(); i++) {
+        double* b = face_box.data() + i * 6;
+        initBox(b);
+        for (uint32_t v : faces[i].vertices) addPointToBox(delmesh.vertices[v], b);
+        for (uint32_t v : faces[i].flat_vertices) addPointToBox(delmesh.vertices[v], b);
+        inflateBox(b);
+    }
+
+    std::vector<unsigned char> needs_check(faces.size(), 1);
+    std::vector<double> mod_boxes; // Regions altered in the current pass (six doubles each)
+
     bool needRecursion, sisMethodWorks = true;
     do {
         needRecursion = false;
+        mod_boxes.clear();
 
         for (size_t i = 0; i < faces.size(); i++) {
+            if (!needs_check[i]) continue;
+            needs_check[i] = 0;
+
             const PLCface& f = faces[i];
             const uint32_t* tv = input_tv + f.triangles[0] * 3; // The vertices of f for orientation
             std::vector<uint64_t> i_tets;
@@ -1396,7 +1573,7 @@ bool PLCx::faceRecovery(bool quiet) {
                     const uint32_t* v = delmesh.getTetNodes(t << 2);
                     for (int j = 0; j < 4; j++)
                         if (v_orient[v[j]] == UNDET_ORIENTATION) {
-                            v_orient[v[j]] = delmesh.vOrient3D(v[j], tv[0], tv[1], tv[2]);
+                            v_orient[v[j]] = memoizedOrient3D(v[j], tv[0], tv[1], tv[2]);
                             cavity_v.push_back(v[j]);
                         }
                 }
@@ -1404,7 +1581,14 @@ bool PLCx::faceRecovery(bool quiet) {
                 //delmesh.recoverFaceGiftWrap(i_tets, v_orient);
                 //sisMethodWorks = false;
 
-                if (!recoverFaceHSi(i_tets, f, sisMethodWorks)) needRecursion = true;
+                double mod_box[6];
+                initBox(mod_box);
+                if (!recoverFaceHSi(i_tets, f, sisMethodWorks, mod_box)) {
+                    needs_check[i] = 1;
+                    needRecursion = true;
+                }
+                inflateBox(mod_box);
+                mod_boxes.insert(mod_boxes.end(), mod_box, mod_box + 6);
 
                 i_tets.clear();
 
@@ -1414,6 +1598,15 @@ bool PLCx::faceRecovery(bool quiet) {
             }
         }
         if (!quiet) printf("\n");
+
+        // Flag the faces whose region may have been affected by this pass
+        for (size_t i = 0; i < faces.size(); i++) if (!needs_check[i])
+            for (size_t j = 0; j < mod_boxes.size(); j += 6)
+                if (boxesOverlap(face_box.data() + i * 6, mod_boxes.data() + j)) {
+                    needs_check[i] = 1;
+                    break;
+                }
+
         if (needRecursion && !quiet) printf("RECURSION\n");
     } while (needRecursion);
 
@@ -1433,7 +1626,7 @@ bool PLCx::isLowerCavityTet(const uint64_t t) const {
 }
 
 
-bool PLCx::recoverFaceHSi(std::vector<uint64_t>& i_tets, const PLCface& f, bool& sisMethodWorks) {
+bool PLCx::recoverFaceHSi(std::vector<uint64_t>& i_tets, const PLCface& f, bool& sisMethodWorks, double* mod_box) {
 
     //std::vector<uint32_t> oldtets;
     //for (uint64_t t : i_tets) {
@@ -1460,7 +1653,7 @@ bool PLCx::recoverFaceHSi(std::vector<uint64_t>& i_tets, const PLCface& f, bool&
     last++; // This is now the numtets after having removed toremove
 
     for (uint64_t t : i_tets) {
-        const uint64_t* neigh = delmesh.getTetNeighs(t << 2);
+        const corner_t* neigh = delmesh.getTetNeighs(t << 2);
         for (int i = 0; i < 4; i++) if (!delmesh.is_marked_Tet_1(neigh[i] >> 2)) {
             if (isUpperCavityTet(neigh[i])) top_faces.push_back(neigh[i]);
             else {
@@ -1516,6 +1709,10 @@ bool PLCx::recoverFaceHSi(std::vector<uint64_t>& i_tets, const PLCface& f, bool&
 
 //    if (!cavity_ok) exit(10);
 
+    // Any tet created below lies within the hull of the cavity vertices
+    for (uint32_t v : top_vertices) addPointToBox(delmesh.vertices[v], mod_box);
+    for (uint32_t v : bottom_vertices) addPointToBox(delmesh.vertices[v], mod_box);
+
     if (cavity_ok) {
         delmesh.tet_node.resize(last * 4);
         delmesh.tet_neigh.resize(last * 4);
@@ -1587,7 +1784,7 @@ uint64_t PLCx::expandCavity(std::vector<uint64_t>& bnd, std::vector<uint32_t>& v
         if (std::find(vertices.begin(), vertices.end(), v) == vertices.end()) {
             const uint32_t* tv = input_tv + f.triangles[0] * 3;
             if (v_orient[v] == UNDET_ORIENTATION) {
-                v_orient[v] = delmesh.vOrient3D(v, tv[0], tv[1], tv[2]);
+                v_orient[v] = memoizedOrient3D(v, tv[0], tv[1], tv[2]);
             }
             vertices.push_back(v);
         }
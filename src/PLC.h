@@ -10,9 +10,18 @@
 #include <set>
 #include <algorithm>
 #include <iomanip>
+#include <atomic>
 
 #pragma intrinsic(fabs)
 
+// Minimum traversal-front size for the parallel orientation resolution
+// in getTetsIntersectingFace()
+#define PAR_FACE_FRONT_MIN_TETS 128
+
+// Minimum number of candidate edges for the parallel missing-edge
+// rescan in segmentRecovery_HSi()
+#define PAR_EDGE_RESCAN_MIN_EDGES 1024
+
 // NOTES: 1) "both_acute_ep" edges will be immediatelly split by inserting the middle point (each subedge becomes a "one_acute_ep")
 //        2) sub-edges of "no_acute_ep" and "one_acute_ep" inherit type
 //        3) "flat" edges will be ignored by segment recovery algorithm and will not be further classyfied
@@ -153,6 +162,85 @@ public:
 
 #define UNDET_ORIENTATION   -2
 
+/// <summary>
+/// orient3DMemo
+/// Lock-free memoization table for exact vertex-vs-plane orientations.
+/// Differently from PLCx::v_orient, which only holds orientations wrt the
+/// plane of the face being processed and is reset at each face, entries
+/// here are keyed on the full (vertex, plane-triple) tuple and persist for
+/// the whole recovery: the repeated passes that recoverFaceHSi runs over
+/// the same face, and distinct faces sharing a support triple, reuse the
+/// cached sign instead of re-running the exact predicate.
+/// The table is a fixed-size open-addressing hash map whose entries are
+/// inserted with a CAS and never removed, so concurrent readers and
+/// writers need no locks. Slots store the key exactly (no fingerprinting:
+/// a collision must never return a wrong exact sign). When the table is
+/// full the cache simply stops growing.
+/// </summary>
+class orient3DMemo {
+    struct entry {
+        std::atomic<uint64_t> k1, k2; // Packed key halves, 0 = empty slot
+        std::atomic<uint32_t> sign;   // Cached sign + 2 (1..3), 0 = not yet written
+    };
+    std::vector<entry> table; // Size is a power of two
+    static constexpr size_t MAX_PROBES = 8;
+
+    // Packed halves are never zero: ids are real vertices, hence < UINT32_MAX
+    static uint64_t packHi(uint32_t v, uint32_t t1) { return (((uint64_t)v + 1) << 32) | ((uint64_t)t1 + 1); }
+    static uint64_t packLo(uint32_t t2, uint32_t t3) { return (((uint64_t)t2 + 1) << 32) | ((uint64_t)t3 + 1); }
+
+    static size_t hash(uint64_t h1, uint64_t h2) {
+        uint64_t h = h1 ^ (h2 * 0x9e3779b97f4a7c15ull);
+        h ^= h >> 32; h *= 0xd6e8feb86659fd93ull; h ^= h >> 32;
+        return (size_t)h;
+    }
+
+public:
+    // Size the table for about 'expected' distinct queries (two slots each)
+    void init(size_t expected) {
+        size_t size = 1 << 16;
+        while (size < expected * 2 && size < ((size_t)1 << 22)) size <<= 1;
+        table = std::vector<entry>(size);
+    }
+
+    bool get(uint32_t v, uint32_t t1, uint32_t t2, uint32_t t3, int& s) const {
+        if (table.empty()) return false;
+        const uint64_t k1 = packHi(v, t1), k2 = packLo(t2, t3);
+        const size_t mask = table.size() - 1;
+        size_t i = hash(k1, k2) & mask;
+        for (size_t p = 0; p < MAX_PROBES; p++, i = (i + 1) & mask) {
+            const entry& e = table[i];
+            const uint64_t e1 = e.k1.load(std::memory_order_acquire);
+            if (e1 == 0) return false;
+            if (e1 == k1 && e.k2.load(std::memory_order_acquire) == k2) {
+                const uint32_t es = e.sign.load(std::memory_order_acquire);
+                if (es == 0) return false; // Another thread is mid-insertion
+                s = (int)es - 2;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void put(uint32_t v, uint32_t t1, uint32_t t2, uint32_t t3, int s) {
+        if (table.empty()) return;
+        const uint64_t k1 = packHi(v, t1), k2 = packLo(t2, t3);
+        const size_t mask = table.size() - 1;
+        size_t i = hash(k1, k2) & mask;
+        for (size_t p = 0; p < MAX_PROBES; p++, i = (i + 1) & mask) {
+            entry& e = table[i];
+            uint64_t expected = 0;
+            if (e.k1.compare_exchange_strong(expected, k1, std::memory_order_acq_rel)) {
+                e.k2.store(k2, std::memory_order_release);
+                e.sign.store((uint32_t)(s + 2), std::memory_order_release);
+                return;
+            }
+            if (expected == k1 && e.k2.load(std::memory_order_acquire) == k2) return; // Already cached
+        }
+        // Neighborhood full: give up caching this entry
+    }
+};
+
 class PLCx{
 public:
   const size_t input_nv; // number of input vertices
@@ -163,6 +251,7 @@ public:
   std::vector<PLCedge> edges; // edges of the PLC
 
   std::vector<int> v_orient; // Pre-computed orientation of vertices wrt one plane
+  orient3DMemo o3d_memo; // Persistent (vertex, plane-triple) orientation cache
   std::vector<std::vector<std::vector<uint32_t>>> vt_maps; // Set of input triangles incident upon each vertex
 
   std::vector<PLCface> faces; // Faces of the PLC
@@ -177,7 +266,7 @@ public:
   { initialize(); };
 
   void initialize();
-  void mergePreEdges(); // Removes duplicated pre-edges
+  void mergePreEdges(std::vector<std::pair<uint64_t, uint32_t>>& pre_edges); // Merges duplicated pre-edges
 
   void pushVertex(pointType* p, uint32_t acute_v_id) {
       delmesh.pushVertex(p);
@@ -217,6 +306,7 @@ public:
 
   bool is_missing_PLCedge(const uint32_t ei) const;
   void find_missing_PLCedges(std::vector<uint32_t>& me) const;
+  void collectMissingEdges(const std::vector<uint32_t>& candidates, std::vector<uint32_t>& me) const;
   bool splitMissingEdge(uint32_t me);
   uint32_t findEncroachingPoint(const PLCedge& e, uint64_t& tet) const;
 
@@ -255,7 +345,11 @@ public:
   int localOrient3d(uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, std::vector<uint32_t>& to_unorient);
   int cachedOrient3D(uint32_t v, uint32_t v1, uint32_t v2, uint32_t v3);
 
-  bool recoverFaceHSi(std::vector<uint64_t>& i_tets, const PLCface& f, bool& sisMethodWorks);
+  // vOrient3D(v, v1, v2, v3) routed through the persistent o3d_memo cache
+  int memoizedOrient3D(uint32_t v, uint32_t v1, uint32_t v2, uint32_t v3);
+
+  // mod_box is grown to enclose the region of the mesh altered by the recovery
+  bool recoverFaceHSi(std::vector<uint64_t>& i_tets, const PLCface& f, bool& sisMethodWorks, double* mod_box);
 
 
   void giftWrap(std::vector<uint64_t>& bnd, const std::vector<uint32_t>& vertices, std::vector<uint32_t>& newtets);
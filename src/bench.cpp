@@ -0,0 +1,176 @@
+#ifdef _MSC_VER // Workaround for known bug on MSVC
+#define _HAS_STD_BYTE 0  // https://developercommunity.visualstudio.com/t/error-c2872-byte-ambiguous-symbol/93889
+#endif
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include "delaunay.h"
+#include "inputPLC.h"
+#include "PLC.h"
+
+using namespace std;
+
+// cdt_bench
+//
+// Microbenchmarks for the building blocks of the CDT pipeline plus
+// end-to-end timings on input files. Results are printed to stdout as a
+// single JSON object so that CI can chart throughput per commit.
+//
+// USAGE: cdt_bench [filename1.off filename2.off ...]
+//
+// Each filename is run through the whole pipeline (DT, segment recovery,
+// face recovery, inner tet marking) with per-stage timings. The synthetic
+// benchmarks run regardless of the arguments.
+
+static double elapsed_ms(const std::chrono::steady_clock::time_point& t0) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// Deterministic pseudo-random doubles in [0,1) so that runs are comparable
+static uint64_t bench_seed = 0x853c49e6748fea9bULL;
+static double bench_rand() {
+    bench_seed = bench_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(bench_seed >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Fill 'coords' with n points distributed as requested:
+// uniform in the unit cube, sampled on a sphere surface, or
+// gathered in a few dense clusters.
+static void makePointCloud(const char* distribution, uint32_t n, std::vector<double>& coords) {
+    coords.clear();
+    coords.reserve((size_t)n * 3);
+    if (strcmp(distribution, "uniform") == 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            coords.push_back(bench_rand());
+            coords.push_back(bench_rand());
+            coords.push_back(bench_rand());
+        }
+    }
+    else if (strcmp(distribution, "surface") == 0) {
+        for (uint32_t i = 0; i < n; i++) {
+            const double z = 2.0 * bench_rand() - 1.0;
+            const double a = 6.283185307179586 * bench_rand();
+            const double r = sqrt(1.0 - z * z);
+            coords.push_back(r * cos(a));
+            coords.push_back(r * sin(a));
+            coords.push_back(z);
+        }
+    }
+    else { // clustered
+        const uint32_t num_clusters = 16;
+        double centers[num_clusters][3];
+        for (uint32_t c = 0; c < num_clusters; c++)
+            for (int j = 0; j < 3; j++) centers[c][j] = bench_rand();
+        for (uint32_t i = 0; i < n; i++) {
+            const double* c = centers[i % num_clusters];
+            coords.push_back(c[0] + 0.01 * bench_rand());
+            coords.push_back(c[1] + 0.01 * bench_rand());
+            coords.push_back(c[2] + 0.01 * bench_rand());
+        }
+    }
+}
+
+// Measure hit rate and throughput of the semi-static predicate filters
+// on random tuples from the unit cube. A 'hit' is a certain (nonzero)
+// result, i.e. no fallback to interval/exact arithmetic is needed.
+static void benchPredicateFilters(uint32_t num_calls) {
+    std::vector<double> p;
+    makePointCloud("uniform", 5 * num_calls, p);
+
+    auto t0 = std::chrono::steady_clock::now();
+    size_t o3d_hits = 0;
+    for (uint32_t i = 0; i < num_calls; i++) {
+        const double* c = p.data() + (size_t)i * 15;
+        if (orient3d_filtered(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8], c[9], c[10], c[11])) o3d_hits++;
+    }
+    const double o3d_ms = elapsed_ms(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    size_t is_hits = 0;
+    for (uint32_t i = 0; i < num_calls; i++) {
+        const double* c = p.data() + (size_t)i * 15;
+        if (inSphere_filtered(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8], c[9], c[10], c[11], c[12], c[13], c[14]) != Filtered_Sign::UNCERTAIN) is_hits++;
+    }
+    const double is_ms = elapsed_ms(t0);
+
+    printf("  \"predicate_filters\": {\n");
+    printf("    \"calls\": %u,\n", num_calls);
+    printf("    \"orient3d_hit_rate\": %f, \"orient3d_mcalls_per_sec\": %f,\n", (double)o3d_hits / num_calls, num_calls / (o3d_ms * 1000.0));
+    printf("    \"insphere_hit_rate\": %f, \"insphere_mcalls_per_sec\": %f\n", (double)is_hits / num_calls, num_calls / (is_ms * 1000.0));
+    printf("  },\n");
+}
+
+// Measure incremental insertion throughput on a synthetic distribution
+static void benchInsertion(const char* distribution, uint32_t n, bool last) {
+    std::vector<double> coords;
+    makePointCloud(distribution, n, coords);
+
+    TetMesh tin;
+    tin.init_vertices(coords.data(), n);
+    auto t0 = std::chrono::steady_clock::now();
+    tin.tetrahedrize();
+    const double ms = elapsed_ms(t0);
+
+    printf("    { \"distribution\": \"%s\", \"points\": %u, \"ms\": %f, \"kpoints_per_sec\": %f, \"tets\": %u }%s\n",
+        distribution, n, ms, n / ms, tin.countNonGhostTets(), last ? "" : ",");
+}
+
+// Time the whole pipeline on one input file, one stage at a time
+static void benchFile(const char* filename, bool last) {
+    inputPLC plc;
+    if (!plc.initFromFile(filename, false)) {
+        printf("    { \"file\": \"%s\", \"error\": \"cannot load\" }%s\n", filename, last ? "" : ",");
+        return;
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    TetMesh tin;
+    tin.init_vertices(plc.coordinates.data(), plc.numVertices());
+    tin.tetrahedrize();
+    const double dt_ms = elapsed_ms(t0);
+
+    PLCx Steiner_plc(tin, plc.triangle_vertices.data(), plc.numTriangles());
+
+    t0 = std::chrono::steady_clock::now();
+    Steiner_plc.segmentRecovery_HSi(true);
+    const double seg_ms = elapsed_ms(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    Steiner_plc.faceRecovery(true);
+    const double face_ms = elapsed_ms(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    const size_t num_inner = Steiner_plc.markInnerTets();
+    const double mark_ms = elapsed_ms(t0);
+
+    printf("    { \"file\": \"%s\", \"input_vertices\": %u, \"steiner_vertices\": %u, \"tets\": %u, \"inner_tets\": %zu,\n",
+        filename, plc.numVertices(), Steiner_plc.numSteinerVertices(), tin.countNonGhostTets(), num_inner);
+    printf("      \"dt_ms\": %f, \"segment_recovery_ms\": %f, \"face_recovery_ms\": %f, \"mark_inner_ms\": %f }%s\n",
+        dt_ms, seg_ms, face_ms, mark_ms, last ? "" : ",");
+}
+
+int main(int argc, char* argv[])
+{
+    initFPU();
+
+    printf("{\n");
+
+    benchPredicateFilters(1000000);
+
+    printf("  \"insertion\": [\n");
+    benchInsertion("uniform", 250000, false);
+    benchInsertion("surface", 250000, false);
+    benchInsertion("clustered", 250000, true);
+    printf("  ],\n");
+
+    printf("  \"end_to_end\": [\n");
+    if (argc < 2) printf("    { \"note\": \"no input files given\" }\n");
+    for (int i = 1; i < argc; i++) benchFile(argv[i], i == argc - 1);
+    printf("  ]\n");
+
+    printf("}\n");
+
+    return 0;
+}
@@ -3,6 +3,8 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include "delaunay.h"
 #include "inputPLC.h"
 #include "PLC.h"
@@ -24,104 +26,115 @@ struct CDTResult {
                   isPolyhedron(false), success(false) {}
 };
 
+// Shared pipeline of the copying and zero-copy entry points.
+// Works in place on the caller's buffers and fills 'result' (whose vectors
+// keep their capacity across calls). Returns false on failure.
+bool computeCDTCore(double* vertices, uint32_t numVertices,
+                    uint32_t* triangles, uint32_t numTriangles,
+                    bool addBoundingBox, bool verbose, CDTResult& result) {
+    // Create input PLC from the buffers
+    inputPLC plc;
+    if (!plc.initFromVectors(vertices, numVertices, triangles, numTriangles, verbose)) {
+        return false; // success remains false
+    }
+
+    if (addBoundingBox) {
+        plc.addBoundingBoxVertices();
+    }
+
+    // Build Delaunay tetrahedrization
+    TetMesh* tin = new TetMesh;
+    tin->init_vertices(plc.coordinates.data(), plc.numVertices());
+    tin->tetrahedrize();
+
+    // Build structured PLC and recover constraints
+    PLCx steinerPLC(*tin, plc.triangle_vertices.data(), plc.numTriangles());
+    steinerPLC.segmentRecovery_HSi(!verbose);
+    bool faceRecoverySuccess = steinerPLC.faceRecovery(!verbose);
+    uint32_t numInnerTets = (uint32_t)steinerPLC.markInnerTets();
+
+    // Extract results
+    result.numInputVertices = plc.numVertices() - (addBoundingBox ? 8 : 0);
+    result.numSteinerVertices = steinerPLC.numSteinerVertices();
+    result.isPolyhedron = steinerPLC.is_polyhedron;
+    result.success = faceRecoverySuccess;
+
+    // Extract vertices (including Steiner points)
+    result.vertices.reserve(tin->numVertices() * 3);
+    for (uint32_t i = 0; i < tin->numVertices(); i++) {
+        double x = 0.0, y = 0.0, z = 0.0; // Initialize to zero
+        tin->vertices[i]->getApproxXYZCoordinates(x, y, z);
+
+        // Verify coordinates are valid before adding
+        if (std::isnan(x) || std::isinf(x) ||
+            std::isnan(y) || std::isinf(y) ||
+            std::isnan(z) || std::isinf(z)) {
+            // Skip invalid vertices or fail the computation
+            delete tin;
+            return false;
+        }
+
+        result.vertices.push_back(x);
+        result.vertices.push_back(y);
+        result.vertices.push_back(z);
+    }
+
+    // Extract tetrahedra (only non-ghost internal ones)
+    uint32_t numTets = tin->numTets();
+    for (uint64_t t = 0; t < numTets; t++) {
+        if (!tin->isGhost(t) && tin->mark_tetrahedra[t] == DT_IN) {
+            uint32_t v0 = tin->tet_node[t * 4];
+            uint32_t v1 = tin->tet_node[t * 4 + 1];
+            uint32_t v2 = tin->tet_node[t * 4 + 2];
+            uint32_t v3 = tin->tet_node[t * 4 + 3];
+
+            // Verify vertex indices are valid
+            uint32_t maxVertexIndex = tin->numVertices();
+            if (v0 >= maxVertexIndex || v1 >= maxVertexIndex ||
+                v2 >= maxVertexIndex || v3 >= maxVertexIndex ||
+                v0 == INFINITE_VERTEX || v1 == INFINITE_VERTEX ||
+                v2 == INFINITE_VERTEX || v3 == INFINITE_VERTEX) {
+                // Skip invalid tetrahedra
+                continue;
+            }
+
+            result.tetrahedra.push_back(v0);
+            result.tetrahedra.push_back(v1);
+            result.tetrahedra.push_back(v2);
+            result.tetrahedra.push_back(v3);
+        }
+    }
+    result.numTetrahedra = result.tetrahedra.size() / 4;
+
+    delete tin;
+    return result.success;
+}
+
 // Main CDT computation function
-CDTResult computeCDT(const std::vector<double>& inputVertices, 
+CDTResult computeCDT(const std::vector<double>& inputVertices,
                      const std::vector<uint32_t>& inputTriangles,
                      bool addBoundingBox = false,
                      bool verbose = false) {
     CDTResult result;
-    
+
     try {
         // Initialize FPU
         initFPU();
-        
-        // Create input PLC from vectors
-        inputPLC plc;
+
         std::vector<double> vertices = inputVertices;
         std::vector<uint32_t> triangles = inputTriangles;
-        
-        if (!plc.initFromVectors(vertices.data(), vertices.size() / 3, 
-                                triangles.data(), triangles.size() / 3, verbose)) {
-            return result; // success remains false
-        }
-        
-        if (addBoundingBox) {
-            plc.addBoundingBoxVertices();
-        }
-        
-        // Build Delaunay tetrahedrization
-        TetMesh* tin = new TetMesh;
-        tin->init_vertices(plc.coordinates.data(), plc.numVertices());
-        tin->tetrahedrize();
-        
-        // Build structured PLC and recover constraints
-        PLCx steinerPLC(*tin, plc.triangle_vertices.data(), plc.numTriangles());
-        steinerPLC.segmentRecovery_HSi(!verbose);
-        bool faceRecoverySuccess = steinerPLC.faceRecovery(!verbose);
-        uint32_t numInnerTets = (uint32_t)steinerPLC.markInnerTets();
-        
-        // Extract results
-        result.numInputVertices = plc.numVertices() - (addBoundingBox ? 8 : 0);
-        result.numSteinerVertices = steinerPLC.numSteinerVertices();
-        result.isPolyhedron = steinerPLC.is_polyhedron;
-        result.success = faceRecoverySuccess;
-        
-        // Extract vertices (including Steiner points)
-        result.vertices.reserve(tin->numVertices() * 3);
-        for (uint32_t i = 0; i < tin->numVertices(); i++) {
-            double x = 0.0, y = 0.0, z = 0.0; // Initialize to zero
-            tin->vertices[i]->getApproxXYZCoordinates(x, y, z);
-            
-            // Verify coordinates are valid before adding
-            if (std::isnan(x) || std::isinf(x) || 
-                std::isnan(y) || std::isinf(y) || 
-                std::isnan(z) || std::isinf(z)) {
-                // Skip invalid vertices or fail the computation
-                result = CDTResult(); // Reset to failed state
-                delete tin;
-                return result;
-            }
-            
-            result.vertices.push_back(x);
-            result.vertices.push_back(y);
-            result.vertices.push_back(z);
-        }
-        
-        // Extract tetrahedra (only non-ghost internal ones)
-        result.tetrahedra.clear();
-        uint32_t numTets = tin->numTets();
-        for (uint64_t t = 0; t < numTets; t++) {
-            if (!tin->isGhost(t) && tin->mark_tetrahedra[t] == DT_IN) {
-                uint32_t v0 = tin->tet_node[t * 4];
-                uint32_t v1 = tin->tet_node[t * 4 + 1];
-                uint32_t v2 = tin->tet_node[t * 4 + 2];
-                uint32_t v3 = tin->tet_node[t * 4 + 3];
-                
-                // Verify vertex indices are valid
-                uint32_t maxVertexIndex = tin->numVertices();
-                if (v0 >= maxVertexIndex || v1 >= maxVertexIndex || 
-                    v2 >= maxVertexIndex || v3 >= maxVertexIndex ||
-                    v0 == INFINITE_VERTEX || v1 == INFINITE_VERTEX ||
-                    v2 == INFINITE_VERTEX || v3 == INFINITE_VERTEX) {
-                    // Skip invalid tetrahedra
-                    continue;
-                }
-                
-                result.tetrahedra.push_back(v0);
-                result.tetrahedra.push_back(v1);
-                result.tetrahedra.push_back(v2);
-                result.tetrahedra.push_back(v3);
-            }
+
+        if (!computeCDTCore(vertices.data(), vertices.size() / 3,
+                            triangles.data(), triangles.size() / 3,
+                            addBoundingBox, verbose, result)) {
+            result = CDTResult(); // Reset to failed state
         }
-        result.numTetrahedra = result.tetrahedra.size() / 4;
-        
-        delete tin;
-        
+
     } catch (const std::exception& e) {
         // Return failed result
         result = CDTResult();
     }
-    
+
     return result;
 }
 
@@ -259,6 +272,64 @@ JSCDTResult computeCDT_withOptions(const emscripten::val& jsVertices,
     return toJSResult(result);
 }
 
+// ------------------- Zero-copy interface -------------------
+//
+// The wrappers above convert JavaScript arrays one element at a time and
+// copy the whole mesh again on return, which triples peak memory on large
+// models. The functions below work directly on the WASM heap instead: the
+// caller allocates the input buffers with allocateDoubleBuffer() /
+// allocateUint32Buffer(), fills them through typed arrays aliasing
+// Module.HEAPF64 / Module.HEAPU32, and receives the result as typed-array
+// views over buffers owned by the module. The views stay valid until the
+// next computeCDTFromHeap() call or a releaseResult(); callers that need
+// the data longer can .slice() them.
+
+static CDTResult heap_result; // Owns the buffers the returned views alias
+
+uintptr_t allocateDoubleBuffer(uint32_t n) { return (uintptr_t)malloc(n * sizeof(double)); }
+uintptr_t allocateUint32Buffer(uint32_t n) { return (uintptr_t)malloc(n * sizeof(uint32_t)); }
+void freeBuffer(uintptr_t ptr) { free((void*)ptr); }
+
+void releaseResult() {
+    heap_result = CDTResult(); // Also releases the vector capacities
+}
+
+emscripten::val computeCDTFromHeap(uintptr_t verticesPtr, uint32_t numVertices,
+                                   uintptr_t trianglesPtr, uint32_t numTriangles,
+                                   bool addBoundingBox, bool verbose) {
+    // Reset the previous result but keep the allocated capacities
+    heap_result.vertices.clear();
+    heap_result.tetrahedra.clear();
+    heap_result.numInputVertices = heap_result.numSteinerVertices = heap_result.numTetrahedra = 0;
+    heap_result.isPolyhedron = heap_result.success = false;
+
+    try {
+        initFPU();
+        if (!computeCDTCore((double*)verticesPtr, numVertices,
+                            (uint32_t*)trianglesPtr, numTriangles,
+                            addBoundingBox, verbose, heap_result)) {
+            heap_result.vertices.clear();
+            heap_result.tetrahedra.clear();
+            heap_result.numTetrahedra = 0;
+            heap_result.success = false;
+        }
+    } catch (const std::exception& e) {
+        heap_result = CDTResult();
+    }
+
+    emscripten::val result = emscripten::val::object();
+    result.set("vertices", emscripten::val(emscripten::typed_memory_view(
+        heap_result.vertices.size(), heap_result.vertices.data())));
+    result.set("tetrahedra", emscripten::val(emscripten::typed_memory_view(
+        heap_result.tetrahedra.size(), heap_result.tetrahedra.data())));
+    result.set("numInputVertices", heap_result.numInputVertices);
+    result.set("numSteinerVertices", heap_result.numSteinerVertices);
+    result.set("numTetrahedra", heap_result.numTetrahedra);
+    result.set("isPolyhedron", heap_result.isPolyhedron);
+    result.set("success", heap_result.success);
+    return result;
+}
+
 // Wrapper for validateMesh to handle JavaScript arrays
 MeshInfo validateMesh_wrapper(const emscripten::val& jsVertices, 
                              const emscripten::val& jsTriangles) {
@@ -292,4 +363,11 @@ EMSCRIPTEN_BINDINGS(cdt_module) {
     emscripten::function("computeCDT", &computeCDT_wrapper);
     emscripten::function("computeCDTWithOptions", &computeCDT_withOptions);
     emscripten::function("validateMesh", &validateMesh_wrapper);
+
+    // Zero-copy interface over the WASM heap (see comment above)
+    emscripten::function("allocateDoubleBuffer", &allocateDoubleBuffer);
+    emscripten::function("allocateUint32Buffer", &allocateUint32Buffer);
+    emscripten::function("freeBuffer", &freeBuffer);
+    emscripten::function("computeCDTFromHeap", &computeCDTFromHeap);
+    emscripten::function("releaseResult", &releaseResult);
 }
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef _CDT_STATS_
+#define _CDT_STATS_
+
+// Optional hot-path statistics to triage slow inputs from the logs alone:
+// they tell whether time went into predicate fallbacks, huge cavities,
+// long location walks or gift-wrapped recoveries.
+// Compile them in with CMake -DSTATS=ON (macro CDT_STATS); when disabled
+// the macros below expand to nothing and the hot paths are untouched.
+// Counters are process-wide and cumulative; the logger appends them as
+// extra CSV columns (see logger.h).
+
+#ifdef CDT_STATS
+
+#include <cstdint>
+#include <atomic>
+
+struct cdtStats {
+    // Scalar explicit-kernel predicates, by the stage that resolved them
+    std::atomic<uint64_t> o3d_filtered, o3d_exact;              // orient3d()
+    std::atomic<uint64_t> isp_filtered, isp_interval, isp_exact; // inSphere()
+
+    // Point location (searchTetrahedron and the insertion walk)
+    std::atomic<uint64_t> walks, walk_steps;
+
+    // Delaunay cavities opened by vertex insertions
+    std::atomic<uint64_t> cavities, cavity_tets;
+
+    // Face recoveries that fell back to gift-wrapping
+    std::atomic<uint64_t> giftwrap_calls;
+};
+
+extern cdtStats cdt_stats; // Defined in delaunay.cpp
+
+#define CDT_STAT_INC(field) cdt_stats.field.fetch_add(1, std::memory_order_relaxed)
+#define CDT_STAT_ADD(field, n) cdt_stats.field.fetch_add((n), std::memory_order_relaxed)
+
+#else
+
+#define CDT_STAT_INC(field)
+#define CDT_STAT_ADD(field, n)
+
+#endif // CDT_STATS
+
+#endif // _CDT_STATS_
@@ -1,15 +1,61 @@
 #include "delaunay.h"
 #include <float.h>
 #include <iomanip>
+#include <atomic>
+#include <charconv>
+#include <map>
+#include <queue>
+#include <sstream>
+#include <thread>
+
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
+#ifdef CDT_STATS
+cdtStats cdt_stats; // Global hot-path counters (see cdt_stats.h)
+#endif
+
+// Semi-static predicate filter bounds (see setStaticFilterBounds()).
+// INFINITY disables the single-comparison pre-stage in the filtered kernels.
+thread_local double o3d_static_filter_bound = INFINITY;
+thread_local double isp_static_filter_bound = INFINITY;
+
 void TetMesh::init_vertices(const double* coords, uint32_t num_v) {
     vertices.reserve(num_v);
+    v_arena.reserve(num_v);
     for (uint32_t i = 0; i < num_v; i++)
-        vertices.push_back(new explicitPoint(coords[i * 3], coords[i * 3 + 1], coords[i * 3 + 2]));
+        vertices.push_back(v_arena.create(coords[i * 3], coords[i * 3 + 1], coords[i * 3 + 2]));
     inc_tet.resize(num_v, UINT64_MAX);
     marked_vertex.resize(num_v, 0);
+
+    setStaticFilterBounds();
+}
+
+void TetMesh::setStaticFilterBounds() const {
+    double mn[3] = { DBL_MAX, DBL_MAX, DBL_MAX }, mx[3] = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+    for (const pointType* p : vertices) if (p->isExplicit3D()) {
+        const double* c = p->toExplicit3D().ptr();
+        for (int j = 0; j < 3; j++) {
+            if (c[j] < mn[j]) mn[j] = c[j];
+            if (c[j] > mx[j]) mx[j] = c[j];
+        }
+    }
+    if (mx[0] < mn[0]) return; // No explicit points: leave the pre-stage disabled
+
+    // Coordinate differences in the filtered predicates cannot exceed the
+    // per-axis ranges: the suprema below bound the dynamic errors for any
+    // points of this mesh (implicit points lie between explicit ones).
+    // The 1.01 inflation absorbs the roundoff in the suprema themselves.
+    const double dx = mx[0] - mn[0], dy = mx[1] - mn[1], dz = mx[2] - mn[2];
+    const double dm = std::max(dx, std::max(dy, dz));
+    o3d_static_filter_bound = 1.01 * (7.7715611723761027e-016 * 6.0) * dx * dy * dz;
+    isp_static_filter_bound = 1.01 * 1.145750161413163e-13 * dm * dm * dm * dm * dm;
 }
 
 void TetMesh::init(uint32_t& unswap_k, uint32_t& unswap_l){
@@ -36,11 +82,11 @@ void TetMesh::init(uint32_t& unswap_k, uint32_t& unswap_l){
   if(ori<0) std::swap(i, j); // Tets must have positive volume
 
   const uint32_t base_tet[] = { l, k, j, i, l, j, k, INFINITE_VERTEX, l, k, i, INFINITE_VERTEX, l, i, j, INFINITE_VERTEX, k, j, i, INFINITE_VERTEX };
-  const uint64_t base_neigh[] = { 19, 15, 11, 7, 18, 10, 13, 3, 17, 14, 5, 2, 16, 6, 9, 1, 12, 8, 4, 0 };
+  const corner_t base_neigh[] = { 19, 15, 11, 7, 18, 10, 13, 3, 17, 14, 5, 2, 16, 6, 9, 1, 12, 8, 4, 0 };
 
   resizeTets(5);
   std::memcpy(getTetNodes(0), base_tet, 20 * sizeof(uint32_t));
-  std::memcpy(getTetNeighs(0), base_neigh, 20 * sizeof(uint64_t));
+  std::memcpy(getTetNeighs(0), base_neigh, 20 * sizeof(corner_t));
 
   // set the vertex-(one_of_the)incident-tetrahedron relation
   inc_tet[i] = inc_tet[j] = inc_tet[k] = inc_tet[l] = 0;
@@ -66,12 +112,135 @@ void TetMesh::tetrahedrize() {
     }
 
     uint64_t ct = 0;
-    for (uint32_t i = 2; i < numVertices(); i++) if (i != uk && i != ul) insertExistingVertex(i, ct);
+    const uint32_t n = numVertices();
+    const unsigned num_threads = std::thread::hardware_concurrency();
+
+    // The main mesh is tetrahedrized before any Steiner point exists, but
+    // faceRecovery also tetrahedrizes small cavity meshes whose vertices may
+    // be implicit: the devirtualized predicates apply only in the former case.
+    bool all_explicit = true;
+    for (uint32_t i = 0; i < n && all_explicit; i++) all_explicit = vertices[i]->isExplicit3D();
+
+    if (n < PAR_LOCATE_MIN_VERTICES || num_threads < 2) {
+        if (all_explicit) { for (uint32_t i = 2; i < n; i++) if (i != uk && i != ul) insertExistingVertexE(i, ct); }
+        else { for (uint32_t i = 2; i < n; i++) if (i != uk && i != ul) insertExistingVertex(i, ct); }
+    }
+    else {
+        // Batched insertion: vertices are consumed in their BRIO order, but the
+        // walk that locates the tet containing each vertex of the next batch is
+        // run by concurrent threads on the frozen mesh. The walks are read-only,
+        // so the only shared mutable state is the per-batch hint array.
+        // Insertions then proceed sequentially using those hints; a hint whose
+        // tet was deleted by an earlier insertion of the same batch falls back
+        // to the plain sequential walk from the last created tet.
+        uint32_t i = 2;
+
+        // Warm-up: grow the mesh sequentially until walks are long enough
+        // for the located hints to pay off.
+        while (i < n && numTets() < PAR_LOCATE_MIN_TETS) {
+            if (i != uk && i != ul) {
+                if (all_explicit) insertExistingVertexE(i, ct);
+                else insertExistingVertex(i, ct);
+            }
+            i++;
+        }
+
+        std::vector<uint32_t> batch;
+        std::vector<uint64_t> hints;
+        std::vector<std::thread> workers(num_threads - 1);
+        batch.reserve(PAR_LOCATE_BATCH_SIZE);
+
+        while (i < n) {
+            batch.clear();
+            while (i < n && batch.size() < PAR_LOCATE_BATCH_SIZE) {
+                if (i != uk && i != ul) batch.push_back(i);
+                i++;
+            }
+            hints.resize(batch.size());
+
+            const uint64_t start_tet = ct;
+            auto locate_chunk = [this, &batch, &hints, start_tet, all_explicit](size_t b, size_t e) {
+                initFPU(); // Interval arithmetic needs the rounding mode set per thread
+                uint64_t w = start_tet;
+                if (all_explicit) for (size_t j = b; j < e; j++) hints[j] = w = searchTetrahedronE(w, batch[j]);
+                else for (size_t j = b; j < e; j++) hints[j] = w = searchTetrahedron(w, batch[j]);
+            };
+
+            const size_t chunk = batch.size() / num_threads + 1;
+            size_t b = 0;
+            for (std::thread& w : workers) {
+                const size_t e = std::min(b + chunk, batch.size());
+                w = std::thread(locate_chunk, b, e);
+                b = e;
+            }
+            locate_chunk(b, batch.size());
+            for (std::thread& w : workers) w.join();
+
+            for (size_t j = 0; j < batch.size(); j++) {
+                if (!isToDelete(hints[j])) ct = hints[j];
+                if (all_explicit) insertExistingVertexE(batch[j], ct);
+                else insertExistingVertex(batch[j], ct);
+            }
+        }
+    }
 
     removeDelTets();
 }
 
 
+// -- Buffered text output --
+// The save* functions below used to emit one '<<' per coordinate, which
+// dominates the save time on large meshes. Records are now formatted with
+// std::to_chars into per-thread string buffers which are then written with
+// one call each. Doubles use the shortest round-trip representation, so no
+// coordinate is altered by a save/reparse cycle.
+
+static void appendDouble(std::string& out, const double d) {
+    char num[32];
+    const auto r = std::to_chars(num, num + sizeof(num), d);
+    out.append(num, r.ptr - num);
+}
+
+static void appendUint(std::string& out, const uint32_t u) {
+    char num[16];
+    const auto r = std::to_chars(num, num + sizeof(num), u);
+    out.append(num, r.ptr - num);
+}
+
+// Run fill(begin, end, buffer) on num_items split among all cores; bufs
+// holds one formatted buffer per chunk, in order.
+template<class F>
+static void formatParallel(const uint32_t num_items, std::vector<std::string>& bufs, const F& fill) {
+    unsigned num_threads = std::thread::hardware_concurrency();
+    if (num_threads < 2 || num_items < 16384) num_threads = 1;
+
+    const uint32_t chunk = num_items / num_threads + 1;
+    bufs.assign(num_threads, std::string());
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < num_threads; t++)
+        workers.emplace_back([&, t]() {
+            initFPU(); // Approximating implicit points uses interval arithmetic
+            const uint32_t b = t * chunk;
+            fill(b, std::min(b + chunk, num_items), bufs[t]);
+        });
+    fill(0, std::min(chunk, num_items), bufs[0]);
+    for (std::thread& w : workers) w.join();
+}
+
+// Vertex coordinates, one per line, each line closed by 'suffix'
+static void formatVertexChunk(const std::vector<pointType*>& vertices, uint32_t begin, uint32_t end,
+    const char* suffix, std::string& out) {
+    double c[3];
+    out.reserve((size_t)(end - begin) * 64);
+    for (uint32_t i = begin; i < end; i++) {
+        vertices[i]->getApproxXYZCoordinates(c[0], c[1], c[2], true);
+        appendDouble(out, c[0]); out.push_back(' ');
+        appendDouble(out, c[1]); out.push_back(' ');
+        appendDouble(out, c[2]); out.append(suffix);
+    }
+}
+
 bool TetMesh::saveTET(const char* filename, bool inner_only) const
 {
     ofstream f(filename);
@@ -86,24 +255,38 @@ bool TetMesh::saveTET(const char* filename, bool inner_only) const
     uint32_t ngnt = 0;
     for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN) ngnt++;
 
-    if (inner_only) {
-        f << ngnt << " tets\n";
-        for (uint32_t i = 0; i < numVertices(); i++)
-            f << *vertices[i] << "\n";
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f << "4 " << tet_node[i * 4] << " " << tet_node[i * 4 + 1] << " " << tet_node[i * 4 + 2] << " " << tet_node[i * 4 + 3] << "\n";
-    }
+    if (inner_only) f << ngnt << " tets\n";
     else {
         f << ngnt << " inner tets\n";
         f << countNonGhostTets()-ngnt << " outer tets\n";
-        for (uint32_t i = 0; i < numVertices(); i++)
-            f << *vertices[i] << "\n";
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f << "4 " << tet_node[i * 4] << " " << tet_node[i * 4 + 1] << " " << tet_node[i * 4 + 2] << " " << tet_node[i * 4 + 3] << "\n";
-        for (uint32_t i = 0; i < numTets(); i++) if (!isGhost(i) && mark_tetrahedra[i] != DT_IN)
-            f << "4 " << tet_node[i * 4] << " " << tet_node[i * 4 + 1] << " " << tet_node[i * 4 + 2] << " " << tet_node[i * 4 + 3] << "\n";
     }
-    
+
+    std::vector<std::string> bufs;
+    formatParallel(numVertices(), bufs, [this](uint32_t b, uint32_t e, std::string& out) {
+        formatVertexChunk(vertices, b, e, "\n", out);
+    });
+    for (const std::string& s : bufs) f.write(s.data(), s.size());
+
+    const auto tets_with_mark = [this](const bool inner, uint32_t b, uint32_t e, std::string& out) {
+        out.reserve((size_t)(e - b) * 32);
+        for (uint32_t i = b; i < e; i++) {
+            if (inner ? (mark_tetrahedra[i] != DT_IN) : (isGhost(i) || mark_tetrahedra[i] == DT_IN)) continue;
+            out.append("4 ");
+            appendUint(out, tet_node[i * 4]); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 1]); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 2]); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 3]); out.push_back('\n');
+        }
+    };
+
+    formatParallel(numTets(), bufs, [&](uint32_t b, uint32_t e, std::string& out) { tets_with_mark(true, b, e, out); });
+    for (const std::string& s : bufs) f.write(s.data(), s.size());
+
+    if (!inner_only) {
+        formatParallel(numTets(), bufs, [&](uint32_t b, uint32_t e, std::string& out) { tets_with_mark(false, b, e, out); });
+        for (const std::string& s : bufs) f.write(s.data(), s.size());
+    }
+
     f.close();
 
     return true;
@@ -126,23 +309,31 @@ bool TetMesh::saveMEDIT(const char* filename, bool inner_only) const
     uint32_t ngnt = 0;
     for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN) ngnt++;
 
-    f << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+    std::vector<std::string> bufs;
+    formatParallel(numVertices(), bufs, [this](uint32_t b, uint32_t e, std::string& out) {
+        formatVertexChunk(vertices, b, e, " 1\n", out);
+    });
+    for (const std::string& s : bufs) f.write(s.data(), s.size());
+
+    f << "Tetrahedra\n" << (inner_only ? ngnt : countNonGhostTets()) << "\n";
+
+    const auto tets_with_mark = [this](const bool inner, uint32_t b, uint32_t e, std::string& out) {
+        out.reserve((size_t)(e - b) * 32);
+        for (uint32_t i = b; i < e; i++) {
+            if (inner ? (mark_tetrahedra[i] != DT_IN) : (isGhost(i) || mark_tetrahedra[i] == DT_IN)) continue;
+            appendUint(out, tet_node[i * 4] + 1); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 2] + 1); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 1] + 1); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 3] + 1); out.append(inner ? " 1\n" : " 2\n");
+        }
+    };
 
-    if (inner_only) {
-        for (uint32_t i = 0; i < numVertices(); i++)
-            f << *vertices[i] << " 1\n";
-        f << "Tetrahedra\n" << ngnt << "\n";
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f << tet_node[i * 4]+1 << " " << tet_node[i * 4 + 2] + 1 << " " << tet_node[i * 4 + 1] + 1 << " " << tet_node[i * 4 + 3] + 1 << " 1\n";
-    }
-    else {
-        for (uint32_t i = 0; i < numVertices(); i++)
-            f << *vertices[i] << " 1\n";
-        f << "Tetrahedra\n" << countNonGhostTets() << "\n";
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f << tet_node[i * 4] + 1 << " " << tet_node[i * 4 + 2] + 1 << " " << tet_node[i * 4 + 1] + 1 << " " << tet_node[i * 4 + 3] + 1 << " 1\n";
-        for (uint32_t i = 0; i < numTets(); i++) if (!isGhost(i) && mark_tetrahedra[i] != DT_IN)
-            f << tet_node[i * 4] + 1 << " " << tet_node[i * 4 + 2] + 1 << " " << tet_node[i * 4 + 1] + 1 << " " << tet_node[i * 4 + 3] + 1 << " 2\n";
+    formatParallel(numTets(), bufs, [&](uint32_t b, uint32_t e, std::string& out) { tets_with_mark(true, b, e, out); });
+    for (const std::string& s : bufs) f.write(s.data(), s.size());
+
+    if (!inner_only) {
+        formatParallel(numTets(), bufs, [&](uint32_t b, uint32_t e, std::string& out) { tets_with_mark(false, b, e, out); });
+        for (const std::string& s : bufs) f.write(s.data(), s.size());
     }
 
     f.close();
@@ -153,27 +344,79 @@ bool TetMesh::saveMEDIT(const char* filename, bool inner_only) const
 
 bool TetMesh::saveBinaryTET(const char* filename, bool inner_only) const
 {
-    ofstream f(filename, ios::binary);
-
-    if (!f) {
-        std::cerr << "\nTetMesh::saveBinaryTET: Can't open file for writing.\n";
-        return false;
-    }
-
     uint32_t num_v = numVertices(), num_t = 0;
 
     for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN) num_t++;
+    const uint32_t num_o = countNonGhostTets() - num_t;
 
-    f << num_v << " vertices\n";
+    std::string header;
+    appendUint(header, num_v); header.append(" vertices\n");
+    if (inner_only) { appendUint(header, num_t); header.append(" tets\n"); }
+    else {
+        appendUint(header, num_t); header.append(" inner tets\n");
+        appendUint(header, num_o); header.append(" outer tets\n");
+    }
+
+#ifndef _MSC_VER
+    // Zero-copy path: size the file upfront and scatter the records straight
+    // into a memory mapping, so the whole save needs no buffered writes.
+    // Any failure falls through to the portable ofstream path below.
+    const size_t fsize = header.size() + (size_t)num_v * 3 * sizeof(double) +
+        ((size_t)num_t + (inner_only ? 0 : num_o)) * 4 * sizeof(uint32_t);
+    const int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+        char* map = (char*)MAP_FAILED;
+        if (ftruncate(fd, (off_t)fsize) == 0)
+            map = (char*)mmap(NULL, fsize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (map != (char*)MAP_FAILED) {
+            memcpy(map, header.data(), header.size());
+            char* vc = map + header.size();
+
+            // Approximate the vertex coordinates on all cores
+            unsigned num_threads = std::thread::hardware_concurrency();
+            if (num_threads < 2 || num_v < 16384) num_threads = 1;
+            const uint32_t chunk = num_v / num_threads + 1;
+            const auto fill_coords = [this, vc](uint32_t b, uint32_t e) {
+                initFPU(); // Approximating implicit points uses interval arithmetic
+                double c[3];
+                for (uint32_t i = b; i < e; i++) {
+                    vertices[i]->getApproxXYZCoordinates(c[0], c[1], c[2], true);
+                    memcpy(vc + (size_t)i * 3 * sizeof(double), c, 3 * sizeof(double));
+                }
+            };
+            std::vector<std::thread> workers;
+            for (unsigned t = 1; t < num_threads; t++)
+                workers.emplace_back(fill_coords, t * chunk, std::min((t + 1) * chunk, num_v));
+            fill_coords(0, std::min(chunk, num_v));
+            for (std::thread& w : workers) w.join();
+
+            char* tc = vc + (size_t)num_v * 3 * sizeof(double);
+            const uint32_t* tnd = tet_node.data();
+            for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN) {
+                memcpy(tc, tnd + i * 4, 4 * sizeof(uint32_t)); tc += 4 * sizeof(uint32_t);
+            }
+            if (!inner_only)
+                for (uint32_t i = 0; i < numTets(); i++) if (!isGhost(i) && mark_tetrahedra[i] != DT_IN) {
+                    memcpy(tc, tnd + i * 4, 4 * sizeof(uint32_t)); tc += 4 * sizeof(uint32_t);
+                }
 
-    if (inner_only) {
-        f << num_t << " tets\n";
+            munmap(map, fsize);
+            close(fd);
+            return true;
+        }
+        close(fd);
     }
-    else {
-        f << num_t << " inner tets\n";
-        f << countNonGhostTets() - num_t << " outer tets\n";
+#endif
+
+    ofstream f(filename, ios::binary);
+
+    if (!f) {
+        std::cerr << "\nTetMesh::saveBinaryTET: Can't open file for writing.\n";
+        return false;
     }
 
+    f.write(header.data(), header.size());
+
     double c[3];
     for (uint32_t i = 0; i < numVertices(); i++) {
         vertices[i]->getApproxXYZCoordinates(c[0], c[1], c[2], true);
@@ -182,19 +425,168 @@ bool TetMesh::saveBinaryTET(const char* filename, bool inner_only) const
 
     const uint32_t* tnd = tet_node.data();
 
-    if (inner_only) {
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f.write((const char*)(tnd + i * 4), sizeof(uint32_t) * 4);
-    }
-    else {
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f.write((const char*)(tnd + i * 4), sizeof(uint32_t) * 4);
+    for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
+        f.write((const char*)(tnd + i * 4), sizeof(uint32_t) * 4);
+    if (!inner_only)
         for (uint32_t i = 0; i < numTets(); i++) if (!isGhost(i) && mark_tetrahedra[i] != DT_IN)
             f.write((const char*)(tnd + i * 4), sizeof(uint32_t) * 4);
+
+    f.close();
+
+    return true;
+}
+
+// Snapshot format (all binary, fixed-size records so that the file can be mapped):
+//  8 bytes magic "TMSNAP01"
+//  uint32_t num_vertices, uint64_t num_corners (= 4 * num_tets)
+//  num_vertices records of 40 bytes each:
+//    explicit vertex: uint32_t 0, uint32_t unused x2, 4 padding bytes, then x,y,z
+//    LNC vertex:      uint32_t 1, the indexes of its two endpoints, 4 padding bytes, then t and two unused doubles
+//  tet_node, tet_neigh, mark_tetrahedra, inc_tet dumped as raw arrays
+#define SNAPSHOT_MAGIC "TMSNAP01"
+
+struct snapshotVertex {
+    uint32_t tag; // 0 = explicit, 1 = LNC
+    uint32_t i0, i1; // LNC endpoint indexes
+    double d[3]; // x,y,z if explicit, {t,-,-} if LNC
+};
+
+// The struct is dumped as-is: pin the padded layout the format documents
+static_assert(sizeof(snapshotVertex) == 40, "snapshot record size must match the documented format");
+
+bool TetMesh::saveSnapshot(const char* filename) const
+{
+    ofstream f(filename, ios::binary);
+
+    if (!f) {
+        std::cerr << "\nTetMesh::saveSnapshot: Can't open file for writing.\n";
+        return false;
+    }
+
+    // LNC endpoints are themselves mesh vertices: store their indexes.
+    // The map is only filled if some LNC vertex actually exists.
+    std::map<const pointType*, uint32_t> vmap;
+    for (uint32_t i = 0; i < numVertices(); i++) if (!vertices[i]->isExplicit3D()) {
+        for (uint32_t j = 0; j < numVertices(); j++) if (vertices[j]->isExplicit3D()) vmap[vertices[j]] = j;
+        break;
+    }
+
+    const uint32_t num_v = numVertices();
+    const uint64_t num_c = tet_node.size();
+    f.write(SNAPSHOT_MAGIC, 8);
+    f.write((const char*)(&num_v), sizeof(uint32_t));
+    f.write((const char*)(&num_c), sizeof(uint64_t));
+
+    for (uint32_t i = 0; i < num_v; i++) {
+        snapshotVertex r = { 0, 0, 0, { 0.0, 0.0, 0.0 } };
+        if (vertices[i]->isExplicit3D()) {
+            const explicitPoint& p = vertices[i]->toExplicit3D();
+            r.d[0] = p.X(); r.d[1] = p.Y(); r.d[2] = p.Z();
+        }
+        else {
+            const implicitPoint_LNC& p = vertices[i]->toLNC();
+            const auto e0 = vmap.find(&p.P()), e1 = vmap.find(&p.Q());
+            if (e0 == vmap.end() || e1 == vmap.end()) {
+                std::cerr << "\nTetMesh::saveSnapshot: LNC endpoint is not a mesh vertex.\n";
+                return false;
+            }
+            r.tag = 1; r.i0 = e0->second; r.i1 = e1->second; r.d[0] = p.T();
+        }
+        f.write((const char*)(&r), sizeof(snapshotVertex));
+    }
+
+    f.write((const char*)tet_node.data(), sizeof(uint32_t) * tet_node.size());
+#ifdef USE_32BIT_ADJACENCY
+    {
+        // Snapshots store 64-bit corners regardless of the in-memory width,
+        // so files remain interchangeable between the two build modes
+        const std::vector<uint64_t> wide_neigh(tet_neigh.begin(), tet_neigh.end());
+        f.write((const char*)wide_neigh.data(), sizeof(uint64_t) * wide_neigh.size());
     }
+#else
+    f.write((const char*)tet_neigh.data(), sizeof(uint64_t) * tet_neigh.size());
+#endif
+    f.write((const char*)mark_tetrahedra.data(), sizeof(uint32_t) * mark_tetrahedra.size());
+    f.write((const char*)inc_tet.data(), sizeof(uint64_t) * inc_tet.size());
+    f.close();
+
+    return true;
+}
+
+bool TetMesh::loadSnapshot(const char* filename)
+{
+    ifstream f(filename, ios::binary);
+
+    if (!f) {
+        std::cerr << "\nTetMesh::loadSnapshot: Can't open file for reading.\n";
+        return false;
+    }
+
+    char magic[8];
+    uint32_t num_v;
+    uint64_t num_c;
+    f.read(magic, 8);
+    f.read((char*)(&num_v), sizeof(uint32_t));
+    f.read((char*)(&num_c), sizeof(uint64_t));
+    if (!f || memcmp(magic, SNAPSHOT_MAGIC, 8) != 0) {
+        std::cerr << "\nTetMesh::loadSnapshot: Not a snapshot file.\n";
+        return false;
+    }
+
+    flushVertices();
+    vertices.clear();
+    vertices.resize(num_v, NULL);
 
+    std::vector<snapshotVertex> recs(num_v);
+    f.read((char*)recs.data(), sizeof(snapshotVertex) * num_v);
+
+    // Explicit points first, so that LNC endpoints exist when referenced
+    v_arena.reserve(num_v);
+    for (uint32_t i = 0; i < num_v; i++) if (recs[i].tag == 0)
+        vertices[i] = v_arena.create(recs[i].d[0], recs[i].d[1], recs[i].d[2]);
+    for (uint32_t i = 0; i < num_v; i++) if (recs[i].tag == 1) {
+        if (recs[i].i0 >= num_v || recs[i].i1 >= num_v ||
+            vertices[recs[i].i0] == NULL || vertices[recs[i].i1] == NULL) {
+            std::cerr << "\nTetMesh::loadSnapshot: Corrupted LNC record.\n";
+            return false;
+        }
+        vertices[i] = new implicitPoint_LNC(vertices[recs[i].i0]->toExplicit3D(), vertices[recs[i].i1]->toExplicit3D(), recs[i].d[0]);
+    }
+
+    tet_node.resize(num_c);
+    tet_neigh.resize(num_c);
+    mark_tetrahedra.resize(num_c >> 2);
+    inc_tet.resize(num_v);
+    f.read((char*)tet_node.data(), sizeof(uint32_t) * num_c);
+#ifdef USE_32BIT_ADJACENCY
+    {
+        // Corners are 64-bit on disk (see saveSnapshot())
+        std::vector<uint64_t> wide_neigh(num_c);
+        f.read((char*)wide_neigh.data(), sizeof(uint64_t) * num_c);
+        for (uint64_t i = 0; i < num_c; i++) tet_neigh[i] = (corner_t)wide_neigh[i];
+    }
+#else
+    f.read((char*)tet_neigh.data(), sizeof(uint64_t) * num_c);
+#endif
+    f.read((char*)mark_tetrahedra.data(), sizeof(uint32_t) * (num_c >> 2));
+    f.read((char*)inc_tet.data(), sizeof(uint64_t) * num_v);
+    if (!f) {
+        std::cerr << "\nTetMesh::loadSnapshot: Truncated snapshot file.\n";
+        return false;
+    }
+
+    marked_vertex.clear();
+    marked_vertex.resize(num_v, 0);
+    Del_deleted.clear();
+    for (uint64_t t = 0; t < (num_c >> 2); t++)
+        if (isToDelete(t << 2)) Del_deleted.push_back(t << 2);
+    loc_grid.clear();
+    loc_grid_built_verts = 0;
+    enc_grid.clear();
     f.close();
 
+    setStaticFilterBounds();
+
     return true;
 }
 
@@ -243,28 +635,44 @@ bool TetMesh::saveRationalTET(const char* filename, bool inner_only)
     uint32_t ngnt = 0;
     for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN) ngnt++;
 
-    if (inner_only) {
-        f << ngnt << " tets\n";
-        for (uint32_t i = 0; i < numVertices(); i++) {
-            bigrational c[3];
-            vertices[i]->getExactXYZCoordinates(c[0], c[1], c[2]);
-            f << c[0] << " " << c[1] << " " << c[2] << "\n";
-        }
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f << "4 " << tet_node[i * 4] << " " << tet_node[i * 4 + 1] << " " << tet_node[i * 4 + 2] << " " << tet_node[i * 4 + 3] << "\n";
-    }
+    if (inner_only) f << ngnt << " tets\n";
     else {
         f << ngnt << " inner tets\n";
         f << countNonGhostTets() - ngnt << " outer tets\n";
-        for (uint32_t i = 0; i < numVertices(); i++) {
-            bigrational c[3];
+    }
+
+    // Decimal expansions of the exact coordinates; Steiner points expanded
+    // during recovery reuse their cached lambdas (see getExactXYZCoordinates)
+    std::vector<std::string> bufs;
+    formatParallel(numVertices(), bufs, [this](uint32_t b, uint32_t e, std::string& out) {
+        std::ostringstream os;
+        bigrational c[3];
+        for (uint32_t i = b; i < e; i++) {
             vertices[i]->getExactXYZCoordinates(c[0], c[1], c[2]);
-            f << c[0] << " " << c[1] << " " << c[2] << "\n";
+            os << c[0] << " " << c[1] << " " << c[2] << "\n";
         }
-        for (uint32_t i = 0; i < numTets(); i++) if (mark_tetrahedra[i] == DT_IN)
-            f << "4 " << tet_node[i * 4] << " " << tet_node[i * 4 + 1] << " " << tet_node[i * 4 + 2] << " " << tet_node[i * 4 + 3] << "\n";
-        for (uint32_t i = 0; i < numTets(); i++) if (!isGhost(i) && mark_tetrahedra[i] != DT_IN)
-            f << "4 " << tet_node[i * 4] << " " << tet_node[i * 4 + 1] << " " << tet_node[i * 4 + 2] << " " << tet_node[i * 4 + 3] << "\n";
+        out = os.str();
+    });
+    for (const std::string& s : bufs) f.write(s.data(), s.size());
+
+    const auto tets_with_mark = [this](const bool inner, uint32_t b, uint32_t e, std::string& out) {
+        out.reserve((size_t)(e - b) * 32);
+        for (uint32_t i = b; i < e; i++) {
+            if (inner ? (mark_tetrahedra[i] != DT_IN) : (isGhost(i) || mark_tetrahedra[i] == DT_IN)) continue;
+            out.append("4 ");
+            appendUint(out, tet_node[i * 4]); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 1]); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 2]); out.push_back(' ');
+            appendUint(out, tet_node[i * 4 + 3]); out.push_back('\n');
+        }
+    };
+
+    formatParallel(numTets(), bufs, [&](uint32_t b, uint32_t e, std::string& out) { tets_with_mark(true, b, e, out); });
+    for (const std::string& s : bufs) f.write(s.data(), s.size());
+
+    if (!inner_only) {
+        formatParallel(numTets(), bufs, [&](uint32_t b, uint32_t e, std::string& out) { tets_with_mark(false, b, e, out); });
+        for (const std::string& s : bufs) f.write(s.data(), s.size());
     }
 
     f.close();
@@ -368,7 +776,7 @@ void TetMesh::getFaceVertices(uint64_t t, uint32_t v[3]) const {
 }
 
 bool TetMesh::getTetsFromFaceVertices(uint32_t v1, uint32_t v2, uint32_t v3, uint64_t* nt) const {
-    static std::vector<uint64_t> vt; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint64_t> vt; // Static to avoid reallocation at each call
     VTfull(v1, vt);
     int i = 0;
     for (uint64_t t : vt) if (tetHasVertex(t, v2) && tetHasVertex(t, v3)) nt[i++] = t;
@@ -387,6 +795,10 @@ uint64_t TetMesh::tetOppositeCorner(uint64_t t, uint32_t v1, uint32_t v2, uint32
 }
 
 void TetMesh::resizeTets(uint64_t new_size) {
+#ifdef USE_32BIT_ADJACENCY
+    if (new_size > (UINT32_MAX >> 2))
+        ip_error("TetMesh::resizeTets() - Too many tets for 32-bit adjacency mode.\n");
+#endif
     mark_tetrahedra.resize(new_size, 0);
     new_size <<= 2;
     tet_node.resize(new_size);
@@ -400,19 +812,23 @@ void TetMesh::reserveTets(uint64_t new_capacity) {
     tet_neigh.reserve(new_capacity);
 }
 
-uint64_t TetMesh::searchTetrahedron(uint64_t tet, const uint32_t v_id)
+template<bool ALL_EXPLICIT>
+uint64_t TetMesh::searchTetrahedronT(uint64_t tet, const uint32_t v_id)
 {
     if (tet_node[tet + 3] == INFINITE_VERTEX)
         tet = getIthNeighbor(getTetNeighs(tet), 3);
 
+    CDT_STAT_INC(walks);
+
     uint64_t i, f0 = 4;
     do {
+        CDT_STAT_INC(walk_steps);
         const uint32_t* Node = getTetNodes(tet);
         if (Node[3] == INFINITE_VERTEX) return tet;
 
-        const uint64_t* Neigh = getTetNeighs(tet);
+        const corner_t* Neigh = getTetNeighs(tet);
         for (i = 0; i < 4; i++)
-            if (i != f0 && vOrient3D(Node[tetON1(i)], Node[tetON2(i)], Node[tetON3(i)], v_id) < 0) {
+            if (i != f0 && vOrient3DT<ALL_EXPLICIT>(Node[tetON1(i)], Node[tetON2(i)], Node[tetON3(i)], v_id) < 0) {
                 tet = getIthNeighbor(Neigh, i);
                 f0 = Neigh[i] & 3;
                 break;
@@ -422,6 +838,79 @@ uint64_t TetMesh::searchTetrahedron(uint64_t tet, const uint32_t v_id)
     return tet;
 }
 
+uint64_t TetMesh::searchTetrahedron(uint64_t tet, const uint32_t v_id) { return searchTetrahedronT<false>(tet, v_id); }
+uint64_t TetMesh::searchTetrahedronE(uint64_t tet, const uint32_t v_id) { return searchTetrahedronT<true>(tet, v_id); }
+
+void TetMesh::rebuildLocatorGrid() {
+    const uint32_t n = numVertices();
+
+    // One cell per vertex on average
+    uint32_t res = (uint32_t)cbrt((double)n);
+    if (res < 4) res = 4;
+    if (res > 256) res = 256;
+
+    // Bounding box of the (possibly approximated) vertex positions
+    double c[3], mn[3] = { DBL_MAX, DBL_MAX, DBL_MAX }, mx[3] = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+    for (uint32_t i = 0; i < n; i++) {
+        if (vertices[i] == NULL || !vertices[i]->getApproxXYZCoordinates(c[0], c[1], c[2])) continue;
+        for (int j = 0; j < 3; j++) {
+            if (c[j] < mn[j]) mn[j] = c[j];
+            if (c[j] > mx[j]) mx[j] = c[j];
+        }
+    }
+    double side = std::max(std::max(mx[0] - mn[0], mx[1] - mn[1]), mx[2] - mn[2]);
+    if (side <= 0.0) side = 1.0;
+
+    loc_grid_res = res;
+    loc_grid_inv_step = res / side;
+    loc_grid_origin[0] = mn[0]; loc_grid_origin[1] = mn[1]; loc_grid_origin[2] = mn[2];
+    loc_grid.assign(((size_t)res) * res * res, UINT32_MAX);
+    loc_grid_built_verts = n;
+
+    for (uint32_t i = 0; i < n; i++) {
+        if (inc_tet[i] == UINT64_MAX || vertices[i] == NULL ||
+            !vertices[i]->getApproxXYZCoordinates(c[0], c[1], c[2])) continue;
+        size_t g[3];
+        for (int j = 0; j < 3; j++) {
+            double gc = (c[j] - loc_grid_origin[j]) * loc_grid_inv_step;
+            if (gc < 0.0) gc = 0.0;
+            g[j] = (size_t)gc;
+            if (g[j] >= res) g[j] = res - 1;
+        }
+        loc_grid[(g[2] * res + g[1]) * res + g[0]] = i;
+    }
+}
+
+uint64_t TetMesh::getApproximateStartingTet(const uint32_t v_id) {
+    // Rebuilding when the mesh has grown by half amortizes to O(1) per insertion
+    if (numVertices() > loc_grid_built_verts + (loc_grid_built_verts >> 1)) rebuildLocatorGrid();
+    if (loc_grid.empty()) return UINT64_MAX;
+
+    double c[3];
+    if (vertices[v_id] == NULL || !vertices[v_id]->getApproxXYZCoordinates(c[0], c[1], c[2])) return UINT64_MAX;
+
+    const int res = (int)loc_grid_res;
+    int g[3];
+    for (int j = 0; j < 3; j++) {
+        double gc = (c[j] - loc_grid_origin[j]) * loc_grid_inv_step;
+        if (gc < 0.0) gc = 0.0;
+        g[j] = (int)gc;
+        if (g[j] >= res) g[j] = res - 1;
+    }
+
+    // Probe the cell of v_id and, if empty, its immediate neighborhood
+    for (int r = 0; r <= 2; r++)
+        for (int z = std::max(g[2] - r, 0); z <= std::min(g[2] + r, res - 1); z++)
+            for (int y = std::max(g[1] - r, 0); y <= std::min(g[1] + r, res - 1); y++)
+                for (int x = std::max(g[0] - r, 0); x <= std::min(g[0] + r, res - 1); x++) {
+                    const uint32_t w = loc_grid[(((size_t)z) * res + y) * res + x];
+                    if (w != UINT32_MAX && w != v_id && inc_tet[w] != UINT64_MAX && !isToDelete(inc_tet[w] << 2))
+                        return inc_tet[w] << 2;
+                }
+
+    return UINT64_MAX;
+}
+
 
 int TetMesh::symbolicPerturbation(uint32_t indices[5]) const {
     int swaps = 0;
@@ -446,8 +935,9 @@ int TetMesh::symbolicPerturbation(uint32_t indices[5]) const {
     return (swaps % 2) ? (n) : (-n);
 }
 
-int TetMesh::vertexInTetSphere(const uint32_t Node[4], uint32_t v_id) const {
-    int det = vInSphere(Node[0], Node[1], Node[2], Node[3], v_id);
+template<bool ALL_EXPLICIT>
+int TetMesh::vertexInTetSphereT(const uint32_t Node[4], uint32_t v_id) const {
+    int det = vInSphereT<ALL_EXPLICIT>(Node[0], Node[1], Node[2], Node[3], v_id);
     if (det) return det;
     uint32_t nn[5] = { Node[0],Node[1],Node[2],Node[3],v_id };
     det = symbolicPerturbation(nn);
@@ -462,27 +952,32 @@ int TetMesh::vertexInTetSphere(const uint32_t Node[4], uint32_t v_id) const {
     return det;
 }
 
-int TetMesh::vertexInTetSphere(uint64_t tet, uint32_t v_id) const
+template<bool ALL_EXPLICIT>
+int TetMesh::vertexInTetSphereT(uint64_t tet, uint32_t v_id) const
 {
   const uint32_t* Node = getTetNodes(tet);
   int det;
 
   if (Node[3] == INFINITE_VERTEX) {
-      if ((det = vOrient3D(Node[0], Node[1], Node[2], v_id)) != 0) return det;
+      if ((det = vOrient3DT<ALL_EXPLICIT>(Node[0], Node[1], Node[2], v_id)) != 0) return det;
       const uint32_t nn[4] = {Node[0], Node[1], Node[2], tet_node[tet_neigh[tet + 3]]};
-      return -vertexInTetSphere(nn, v_id);
+      return -vertexInTetSphereT<ALL_EXPLICIT>(nn, v_id);
   }
-  else return vertexInTetSphere(Node, v_id);
+  else return vertexInTetSphereT<ALL_EXPLICIT>(Node, v_id);
 }
 
+int TetMesh::vertexInTetSphere(const uint32_t Node[4], uint32_t v_id) const { return vertexInTetSphereT<false>(Node, v_id); }
+int TetMesh::vertexInTetSphere(uint64_t tet, uint32_t v_id) const { return vertexInTetSphereT<false>(tet, v_id); }
+
 #ifdef USE_MAROTS_METHOD
 void TetMesh::deleteInSphereTets(uint64_t tet, const uint32_t v_id)
 {
+  const size_t first = Del_deleted.size();
   pushAndMarkDeletedTets(tet);
 
   for(uint64_t t = Del_deleted.size() - 1; t < Del_deleted.size(); t++) {
     uint64_t tet = Del_deleted[t];
-    uint64_t* Neigh = getTetNeighs(tet);
+    corner_t* Neigh = getTetNeighs(tet);
     uint32_t* Node = getTetNodes(tet);
 
     uint64_t neigh = getIthNeighbor(Neigh, 0);
@@ -514,6 +1009,9 @@ void TetMesh::deleteInSphereTets(uint64_t tet, const uint32_t v_id)
       else pushAndMarkDeletedTets(neigh);
     }
   }
+
+  CDT_STAT_INC(cavities);
+  CDT_STAT_ADD(cavity_tets, Del_deleted.size() - first);
 }
 
 
@@ -607,10 +1105,13 @@ void TetMesh::insertExistingVertex(const uint32_t vi, uint64_t& ct)
     inc_tet[vi] = lt >> 2;
 }
 
+// No explicit-only specialization for Marot's method
+void TetMesh::insertExistingVertexE(const uint32_t vi, uint64_t& ct) { insertExistingVertex(vi, ct); }
+
 #else
 // Start from c and turn around v1-v2 as long as adjacencies are well defined.
 // When an invalid adjacency is found, reinit it and exit.
-void TetMesh::seekAndSetMutualAdjacency(int p_o0, int p_o1, int p_o2, const uint32_t* v, uint64_t c, uint64_t o, const uint32_t* tet_node_data, uint64_t* tet_neigh_data) {
+void TetMesh::seekAndSetMutualAdjacency(int p_o0, int p_o1, int p_o2, const uint32_t* v, uint64_t c, uint64_t o, const uint32_t* tet_node_data, corner_t* tet_neigh_data) {
     const uint32_t ov = v[p_o0], v1 = v[p_o1], v2 = v[p_o2];
     o += p_o0;
 
@@ -619,7 +1120,7 @@ void TetMesh::seekAndSetMutualAdjacency(int p_o0, int p_o1, int p_o2, const uint
 
     for (;;) {
         uint64_t t = c;
-        if ((c = tet_neigh_data[c]) == UINT64_MAX) {
+        if ((c = tet_neigh_data[c]) == INVALID_CORNER) {
             tet_neigh_data[t] = o;
             tet_neigh_data[o] = t;
             return;
@@ -631,35 +1132,39 @@ void TetMesh::seekAndSetMutualAdjacency(int p_o0, int p_o1, int p_o2, const uint
 }
 
 // Rebuild internal adjacencies for the cavity tet opposite to c
-void TetMesh::restoreLocalConnectivty(uint64_t c, const uint32_t* tet_node_data, uint64_t* tet_neigh_data) {
+void TetMesh::restoreLocalConnectivty(uint64_t c, const uint32_t* tet_node_data, corner_t* tet_neigh_data) {
     const uint64_t o = tet_neigh_data[c];
     const uint32_t* v = tet_node_data + o;
-    const uint64_t* n = tet_neigh_data + o;
-    if (n[1] == UINT64_MAX) seekAndSetMutualAdjacency(1, 2, 3, v, c, o, tet_node_data, tet_neigh_data);
-    if (n[2] == UINT64_MAX) seekAndSetMutualAdjacency(2, 1, 3, v, c, o, tet_node_data, tet_neigh_data);
-    if (n[3] == UINT64_MAX) seekAndSetMutualAdjacency(3, 1, 2, v, c, o, tet_node_data, tet_neigh_data);
+    const corner_t* n = tet_neigh_data + o;
+    if (n[1] == INVALID_CORNER) seekAndSetMutualAdjacency(1, 2, 3, v, c, o, tet_node_data, tet_neigh_data);
+    if (n[2] == INVALID_CORNER) seekAndSetMutualAdjacency(2, 1, 3, v, c, o, tet_node_data, tet_neigh_data);
+    if (n[3] == INVALID_CORNER) seekAndSetMutualAdjacency(3, 1, 2, v, c, o, tet_node_data, tet_neigh_data);
 }
 
 // Collect all tets whose circumsphere contains v_id and replace them
 // with a star of new tets originating at v_id
-void TetMesh::insertExistingVertex(const uint32_t v_id, uint64_t& tet)
+template<bool ALL_EXPLICIT>
+void TetMesh::insertExistingVertexT(const uint32_t v_id, uint64_t& tet)
 {
-    static std::vector<uint64_t> cavityCorners; // Static to avoid reallocation on each call
+    static thread_local std::vector<uint64_t> cavityCorners; // Static to avoid reallocation on each call
     static const int fi[4][3] = { {2, 1, 3} ,{0, 2, 3} ,{1, 0, 3} ,{0, 1, 2} };
     uint32_t* tet_node_data = tet_node.data();
-    uint64_t* tet_neigh_data = tet_neigh.data();
+    corner_t* tet_neigh_data = tet_neigh.data();
 
     // Move by adjacencies to find the tet containing v_id
     if (tet_node_data[tet + 3] == INFINITE_VERTEX)
         tet = tet_neigh_data[tet + 3] & (~3);
 
+    CDT_STAT_INC(walks);
+
     uint64_t i, f0 = 4;
     do {
+        CDT_STAT_INC(walk_steps);
         const uint32_t* Node = tet_node_data + tet;
         if (Node[3] == INFINITE_VERTEX) break;
 
         for (i = 0; i < 4; i++)
-            if (i != f0 && vOrient3D(Node[tetON1(i)], Node[tetON2(i)], Node[tetON3(i)], v_id) < 0) {
+            if (i != f0 && vOrient3DT<ALL_EXPLICIT>(Node[tetON1(i)], Node[tetON2(i)], Node[tetON3(i)], v_id) < 0) {
                 const uint64_t ni = tet_neigh_data[tet + i];
                 tet = ni & (~3);
                 f0 = ni & 3;
@@ -673,27 +1178,65 @@ void TetMesh::insertExistingVertex(const uint32_t v_id, uint64_t& tet)
     size_t first = Del_deleted.size();
     pushAndMarkDeletedTets(tet << 2);
 
+    const double* vp;
+    if constexpr (ALL_EXPLICIT) vp = vertices[v_id]->toExplicit3D().ptr();
+    else vp = (vertices[v_id]->isExplicit3D()) ? (vertices[v_id]->toExplicit3D().ptr()) : (NULL);
+
     for (size_t i = first; i < Del_deleted.size(); i++) {
-        const uint64_t* nb = tet_neigh_data + Del_deleted[i];
-        const uint64_t* nl = nb + 4;
-
-        for (; nb < nl; nb++)
-        {
-            const uint64_t n0 = *nb >> 2;
-            uint32_t& mtn0 = mark_tetrahedra[n0];
-            if (mtn0 == 0) {
-                if (vertexInTetSphere(n0 << 2, v_id) < 0) {
-                    mtn0 = 2;
-                    cavityCorners.push_back(*nb);
-                }
-                else {
-                    pushAndMarkDeletedTets(n0 << 2);
+        const corner_t* nb = tet_neigh_data + Del_deleted[i];
+
+        // Collect the yet unvisited neighbors of this tet...
+        uint64_t cand[4];
+        int nc = 0;
+        for (int j = 0; j < 4; j++) {
+            const uint64_t n0 = nb[j] >> 2;
+            const uint32_t mtn0 = mark_tetrahedra[n0];
+            if (mtn0 == 0) cand[nc++] = nb[j];
+            else if (mtn0 == 2) cavityCorners.push_back(nb[j]);
+        }
+
+        // ...so that their inSphere semi-static filters can be evaluated in
+        // one SIMD batch. Lanes with a ghost tet or an implicit point, and
+        // lanes whose filter is uncertain, use the standard scalar pipeline.
+        int signs[4] = { Filtered_Sign::UNCERTAIN, Filtered_Sign::UNCERTAIN, Filtered_Sign::UNCERTAIN, Filtered_Sign::UNCERTAIN };
+        if (vp != NULL && nc > 1) {
+            const double* bp[4][4];
+            int lane[4], nbt = 0;
+            for (int k = 0; k < nc; k++) {
+                const uint32_t* tn = tet_node_data + (cand[k] & (~3));
+                if (tn[3] != INFINITE_VERTEX &&
+                    (ALL_EXPLICIT || (vertices[tn[0]]->isExplicit3D() && vertices[tn[1]]->isExplicit3D() &&
+                        vertices[tn[2]]->isExplicit3D() && vertices[tn[3]]->isExplicit3D()))) {
+                    for (int h = 0; h < 4; h++) bp[h][nbt] = vertices[tn[h]]->toExplicit3D().ptr();
+                    lane[nbt++] = k;
                 }
             }
-            else if (mtn0 == 2) cavityCorners.push_back(*nb);
+            if (nbt > 1) {
+                for (int m = nbt; m < 4; m++) // Pad unused lanes with the first one
+                    for (int h = 0; h < 4; h++) bp[h][m] = bp[h][0];
+                int bs[4];
+                inSphere_filtered_batch4(bp[0], bp[1], bp[2], bp[3], vp, bs);
+                // vInSphere negates pointType::inSphere, hence the sign flip
+                for (int m = 0; m < nbt; m++) signs[lane[m]] = -bs[m];
+            }
+        }
+
+        for (int k = 0; k < nc; k++) {
+            const uint64_t n0 = cand[k] >> 2;
+            const int s = (signs[k] != Filtered_Sign::UNCERTAIN) ? (signs[k]) : (vertexInTetSphereT<ALL_EXPLICIT>(n0 << 2, v_id));
+            if (s < 0) {
+                mark_tetrahedra[n0] = 2;
+                cavityCorners.push_back(cand[k]);
+            }
+            else {
+                pushAndMarkDeletedTets(n0 << 2);
+            }
         }
     }
 
+    CDT_STAT_INC(cavities);
+    CDT_STAT_ADD(cavity_tets, Del_deleted.size() - first);
+
     // Resize the mesh to host the new tets
     uint64_t ntb, newpos = tet_node.size();
     if (cavityCorners.size() > Del_deleted.size()) {
@@ -722,7 +1265,7 @@ void TetMesh::insertExistingVertex(const uint32_t v_id, uint64_t& tet)
         *cn++ = cr[fi[cb][2]];
 
         tet_neigh_data[ntb] = c; tet_neigh_data[c] = ntb;
-        tet_neigh_data[ntb + 1] = tet_neigh_data[ntb + 2] = tet_neigh_data[ntb + 3] = UINT64_MAX;
+        tet_neigh_data[ntb + 1] = tet_neigh_data[ntb + 2] = tet_neigh_data[ntb + 3] = INVALID_CORNER;
 
         ntb >>= 2;
         if ((*(--cn)) != INFINITE_VERTEX) {
@@ -741,9 +1284,12 @@ void TetMesh::insertExistingVertex(const uint32_t v_id, uint64_t& tet)
 
     cavityCorners.clear();
 }
+
+void TetMesh::insertExistingVertex(const uint32_t v_id, uint64_t& tet) { insertExistingVertexT<false>(v_id, tet); }
+void TetMesh::insertExistingVertexE(const uint32_t v_id, uint64_t& tet) { insertExistingVertexT<true>(v_id, tet); }
 #endif
 void TetMesh::VT(uint32_t v, std::vector<uint64_t>& vt) const {
-    static std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
     uint64_t t = inc_tet[v];
 
     vt_queue.push_back(tetCornerAtVertex(t << 2, v));
@@ -752,7 +1298,7 @@ void TetMesh::VT(uint32_t v, std::vector<uint64_t>& vt) const {
     for (size_t i = 0; i < vt_queue.size(); i++) {
         t = vt_queue[i];
         const uint64_t sb = t & 3;
-        const uint64_t* tg = tet_neigh.data() + t - sb;
+        const corner_t* tg = tet_neigh.data() + t - sb;
         for (int j = 1; j < 4; j++) {
             const uint64_t tb = tg[(sb+j)&3];
             const uint64_t tbb = tb >> 2;
@@ -772,7 +1318,7 @@ void TetMesh::VT(uint32_t v, std::vector<uint64_t>& vt) const {
 }
 
 void TetMesh::VV(uint32_t v, std::vector<uint32_t>& vv) const {
-    static std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
     uint64_t t = inc_tet[v];
     const uint64_t tb = t << 2;
 
@@ -791,7 +1337,7 @@ void TetMesh::VV(uint32_t v, std::vector<uint32_t>& vv) const {
     for (size_t i = 0; i < vt_queue.size(); i++) {
         t = vt_queue[i];
         const uint64_t sb = t & 3;
-        const uint64_t* tg = tet_neigh.data() + t - sb;
+        const corner_t* tg = tet_neigh.data() + t - sb;
         for (int j = 1; j < 4; j++) {
             const uint64_t tb = tg[(sb + j) & 3];
             const uint64_t tbb = tb >> 2;
@@ -853,7 +1399,7 @@ void TetMesh::ETcorners(uint32_t v1, uint32_t v2, std::vector<uint64_t>& et) con
 }
 
 void TetMesh::VTfull(uint32_t v, std::vector<uint64_t>& vt) const {
-    static std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
     uint64_t s, t = inc_tet[v];
     vt_queue.push_back(t);
     mark_Tet_31(t);
@@ -878,7 +1424,7 @@ void TetMesh::VTfull(uint32_t v, std::vector<uint64_t>& vt) const {
 
 
 bool TetMesh::hasEdge(uint32_t v1, uint32_t v2) const {
-    static std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
     uint64_t t = inc_tet[v1];
     const uint64_t tb = t << 2;
     if (tet_node[tb] == v2 || tet_node[tb + 1] == v2 || tet_node[tb + 2] == v2 || tet_node[tb + 3] == v2) return true;
@@ -889,7 +1435,7 @@ bool TetMesh::hasEdge(uint32_t v1, uint32_t v2) const {
     for (size_t i = 0; i < vt_queue.size(); i++) {
         t = vt_queue[i];
         const uint64_t sb = t & 3;
-        const uint64_t* tg = tet_neigh.data() + t - sb;
+        const corner_t* tg = tet_neigh.data() + t - sb;
         for (int j = 1; j < 4; j++) {
             const uint64_t tb = tg[(sb + j) & 3];
             const uint64_t tbb = tb >> 2;
@@ -911,8 +1457,42 @@ bool TetMesh::hasEdge(uint32_t v1, uint32_t v2) const {
     return false;
 }
 
+bool TetMesh::hasEdgeThreadSafe(uint32_t v1, uint32_t v2) const {
+    static thread_local std::vector<uint64_t> vt_queue; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint8_t> visited; // Private substitute for the shared tet marks
+    if (visited.size() < numTets()) visited.resize(numTets(), 0);
+
+    uint64_t t = inc_tet[v1];
+    const uint64_t tb = t << 2;
+    if (tet_node[tb] == v2 || tet_node[tb + 1] == v2 || tet_node[tb + 2] == v2 || tet_node[tb + 3] == v2) return true;
+
+    vt_queue.push_back(tetCornerAtVertex(tb, v1));
+    visited[t] = 1;
 
-void TetMesh::swapTets(const uint64_t t1, const uint64_t t2) 
+    bool found = false;
+    for (size_t i = 0; !found && i < vt_queue.size(); i++) {
+        t = vt_queue[i];
+        const uint64_t sb = t & 3;
+        const corner_t* tg = tet_neigh.data() + t - sb;
+        for (int j = 1; j < 4; j++) {
+            const uint64_t tb = tg[(sb + j) & 3];
+            const uint64_t tbb = tb >> 2;
+            const uint32_t w = tet_node[tb];
+            if (w != INFINITE_VERTEX && !visited[tbb]) {
+                vt_queue.push_back(tetCornerAtVertex(tbb << 2, v1));
+                visited[tbb] = 1;
+                if (w == v2) { found = true; break; }
+            }
+        }
+    }
+
+    for (uint64_t t : vt_queue) visited[t >> 2] = 0;
+    vt_queue.clear();
+    return found;
+}
+
+
+void TetMesh::swapTets(const uint64_t t1, const uint64_t t2)
 {
     if (t1 == t2) return;
 
@@ -957,6 +1537,48 @@ size_t TetMesh::markInnerTets(std::vector<bool>& cornerMask, uint64_t single_sta
     else for (size_t i = 0; i < numTets(); i++)
         if (mark_tetrahedra[i] == DT_OUT) C.push_back(i);
 
+    const unsigned int num_threads = std::thread::hardware_concurrency();
+    if (single_start == UINT64_MAX && num_threads > 1 && numTets() >= PAR_FLOOD_MIN_TETS) {
+        // Parallel seed-and-grow: the front is expanded one layer at a time,
+        // and threads claim unknown neighbors with a CAS on their mark word.
+        // The mark of a claimed-from tet is final when the tet is in the
+        // front, so the labels propagate exactly as in the sequential visit.
+        std::vector<std::vector<uint64_t>> next_fronts(num_threads);
+        std::vector<std::thread> workers(num_threads);
+
+        while (!C.empty()) {
+            const size_t chunk = C.size() / num_threads + 1;
+            for (unsigned int w = 0; w < num_threads; w++) {
+                const size_t b = std::min(w * chunk, C.size()), e = std::min(b + chunk, C.size());
+                workers[w] = std::thread([this, &C, &cornerMask, &next_fronts, w, b, e]() {
+                    std::vector<uint64_t>& next = next_fronts[w];
+                    for (size_t i = b; i < e; i++) {
+                        const uint64_t t = C[i];
+                        for (int j = 0; j < 4; j++) {
+                            const uint64_t n = tet_neigh[t * 4 + j];
+                            const uint64_t n2 = n >> 2;
+                            const uint32_t m = (!cornerMask[n]) ? (mark_tetrahedra[t]) :
+                                ((mark_tetrahedra[t] == DT_IN) ? (DT_OUT) : (DT_IN));
+                            uint32_t expected = DT_UNKNOWN;
+                            if (mark_tetrahedra[n2] == DT_UNKNOWN &&
+                                std::atomic_ref<uint32_t>(mark_tetrahedra[n2]).compare_exchange_strong(expected, m))
+                                next.push_back(n2);
+                        }
+                    }
+                });
+            }
+            for (std::thread& w : workers) w.join();
+
+            C.clear();
+            for (std::vector<uint64_t>& next : next_fronts) {
+                C.insert(C.end(), next.begin(), next.end());
+                next.clear();
+            }
+        }
+
+        return std::count(mark_tetrahedra.begin(), mark_tetrahedra.end(), DT_IN);
+    }
+
     for (size_t i = 0; i < C.size(); i++) {
         uint64_t t = C[i];
         for (int j = 0; j < 4; j++) {
@@ -1066,13 +1688,53 @@ void TetMesh::checkMesh(bool checkDelaunay) const {
     printf("checkMesh passed\n");
 }
 
-uint32_t TetMesh::findEncroachingPoint(const uint32_t ep0, const uint32_t ep1, uint64_t& tet_e) const {
-    static std::vector<uint64_t> enc_queue; // Static to avoid reallocation upon each call
+size_t TetMesh::encGridCell(const double* c) const {
+    size_t g[3];
+    for (int j = 0; j < 3; j++) {
+        double gc = (c[j] - enc_grid_origin[j]) * enc_grid_inv_step;
+        if (gc < 0.0) gc = 0.0;
+        g[j] = (size_t)gc;
+        if (g[j] >= enc_grid_res) g[j] = enc_grid_res - 1;
+    }
+    return (g[2] * enc_grid_res + g[1]) * enc_grid_res + g[0];
+}
 
-    // Start collecting tetrahedra incident at the endpoints
-    VT(ep0, enc_queue);
+void TetMesh::encGridInsert(uint32_t v) {
+    double c[3];
+    if (vertices[v] == NULL || !vertices[v]->getApproxXYZCoordinates(c[0], c[1], c[2])) return;
+    enc_grid[encGridCell(c)].push_back(v);
+}
+
+void TetMesh::rebuildEncroachmentGrid() {
+    const uint32_t n = numVertices();
+
+    // A few vertices per cell on average: the cell lists dominate the memory
+    uint32_t res = (uint32_t)cbrt((double)n / 4.0);
+    if (res < 4) res = 4;
+    if (res > 128) res = 128;
+
+    // Bounding box of the (possibly approximated) vertex positions
+    double c[3], mn[3] = { DBL_MAX, DBL_MAX, DBL_MAX }, mx[3] = { -DBL_MAX, -DBL_MAX, -DBL_MAX };
+    for (uint32_t i = 0; i < n; i++) {
+        if (vertices[i] == NULL || !vertices[i]->getApproxXYZCoordinates(c[0], c[1], c[2])) continue;
+        for (int j = 0; j < 3; j++) {
+            if (c[j] < mn[j]) mn[j] = c[j];
+            if (c[j] > mx[j]) mx[j] = c[j];
+        }
+    }
+    double side = std::max(std::max(mx[0] - mn[0], mx[1] - mn[1]), mx[2] - mn[2]);
+    if (side <= 0.0) side = 1.0;
+
+    enc_grid_res = res;
+    enc_grid_inv_step = res / side;
+    enc_grid_origin[0] = mn[0]; enc_grid_origin[1] = mn[1]; enc_grid_origin[2] = mn[2];
+    enc_grid.assign(((size_t)res) * res * res, std::vector<uint32_t>());
+
+    for (uint32_t i = 0; i < n; i++) encGridInsert(i);
+}
 
-    for (uint64_t j : enc_queue) mark_Tet_1(j);
+uint32_t TetMesh::findEncroachingPoint(const uint32_t ep0, const uint32_t ep1, uint64_t& tet_e) {
+    if (enc_grid.empty()) rebuildEncroachmentGrid();
 
     const vector3d p0 = vertices[ep0];
     const vector3d p1 = vertices[ep1];
@@ -1081,58 +1743,33 @@ uint32_t TetMesh::findEncroachingPoint(const uint32_t ep0, const uint32_t ep1, u
     vector3d ep;
     uint32_t enc_pt_i = UINT32_MAX;
 
-    marked_vertex[ep0] = marked_vertex[ep1] = 1;
-
-    // Collect all encroaching points while expanding around insphere vertices
-    for (uint32_t ti = 0; ti < enc_queue.size(); ti++) {
-        const uint64_t tet = enc_queue[ti];
-        const uint64_t tb = tet << 2;
-
-        // Check each tet vertex for 'isphereness' and keep track of the one with largest sphere
-        const uint32_t* tn = tet_node.data() + tb;
-        for (uint32_t i = 0; i < 4; i++) {
-            const uint32_t ui = tn[i];
-            if (!marked_vertex[ui]) {              
-                const vector3d& pui = vertices[ui];
-                if (((pui - p0).sq_length() + (pui - p1).sq_length()) <= eslen) {
-                    marked_vertex[ui] = 1;
-                    if (enc_pt_i == UINT32_MAX || vector3d::hasLargerSphere(p0, p1, pui, ep)) {
-                        ep = pui; enc_pt_i = ui;
-                        tet_e = tb;
-                    }
-                } 
-                else marked_vertex[ui] = 2;
-            }
-        }
-
-        const int nvmask[] = { (marked_vertex[tn[0]] == 1), (marked_vertex[tn[1]] == 1), (marked_vertex[tn[2]] == 1), (marked_vertex[tn[3]] == 1) };
-        const int totmarkeda = nvmask[0] + nvmask[1] + nvmask[2] + nvmask[3];
-
-        // Expand on adjacent tets if at least one common vertex is insphere
-        const uint64_t* tg = tet_neigh.data() + tb;
-        for (uint32_t i = 0; i < 4; i++) {
-            const uint64_t nc = tg[i];
-            const uint64_t n = nc >> 2;
-            if (is_marked_Tet_1(n)==2 || tet_node[nc] == INFINITE_VERTEX) continue;
-            const int totmarked = totmarkeda - nvmask[i];
-            if (totmarked) {
-                mark_Tet_1(n);
-                enc_queue.push_back(n);
+    // Cells overlapping the bounding box of the diametral sphere; one extra
+    // cell of slack absorbs the approximation of the gridded coordinates
+    const double cc[3] = { (p0.c[0] + p1.c[0]) * 0.5, (p0.c[1] + p1.c[1]) * 0.5, (p0.c[2] + p1.c[2]) * 0.5 };
+    const double r = 0.5 * sqrt(eslen);
+    const int res = (int)enc_grid_res;
+    int gmin[3], gmax[3];
+    for (int j = 0; j < 3; j++) {
+        const double glo = (cc[j] - r - enc_grid_origin[j]) * enc_grid_inv_step - 1.0;
+        const double ghi = (cc[j] + r - enc_grid_origin[j]) * enc_grid_inv_step + 1.0;
+        gmin[j] = (glo < 0.0) ? 0 : (int)glo;
+        if (gmin[j] > res - 1) gmin[j] = res - 1;
+        gmax[j] = (ghi < 0.0) ? 0 : (int)ghi;
+        if (gmax[j] > res - 1) gmax[j] = res - 1;
+    }
+
+    // Check each candidate for 'isphereness' and keep track of the one with largest sphere
+    for (int z = gmin[2]; z <= gmax[2]; z++) for (int y = gmin[1]; y <= gmax[1]; y++) for (int x = gmin[0]; x <= gmax[0]; x++)
+        for (const uint32_t ui : enc_grid[((size_t)z * res + y) * res + x]) {
+            if (ui == ep0 || ui == ep1 || inc_tet[ui] == UINT64_MAX) continue;
+            const vector3d& pui = vertices[ui];
+            if (((pui - p0).sq_length() + (pui - p1).sq_length()) <= eslen &&
+                (enc_pt_i == UINT32_MAX || vector3d::hasLargerSphere(p0, p1, pui, ep))) {
+                ep = pui; enc_pt_i = ui;
             }
         }
-    }
 
-    // Clear all marks
-    marked_vertex[ep0] = marked_vertex[ep1] = 0;
-    for (uint64_t j : enc_queue) {
-        unmark_Tet_1(j);
-        j <<= 2;
-        marked_vertex[tet_node[j++]] = 0;
-        marked_vertex[tet_node[j++]] = 0;
-        marked_vertex[tet_node[j++]] = 0;
-        marked_vertex[tet_node[j]] = 0;
-    }
-    enc_queue.clear();
+    if (enc_pt_i != UINT32_MAX) tet_e = inc_tet[enc_pt_i] << 2;
 
     return enc_pt_i;
 }
@@ -1166,10 +1803,7 @@ double tetEnergy(const pointType *p1, const pointType* p2, const pointType* p3,
 }
 
 // 2-3 swap
-bool TetMesh::swapFace(uint64_t r, bool prevent_inversion, double th_energy) {
-    const uint64_t b2 = tet_node.size();
-    const size_t newsize = tet_node.size() + 4;
-
+bool TetMesh::swapFace(uint64_t r, bool prevent_inversion, double th_energy, uint64_t* new_tet) {
     const uint64_t cb = r & 3;
     const uint64_t t = r - cb;
 
@@ -1199,9 +1833,9 @@ bool TetMesh::swapFace(uint64_t r, bool prevent_inversion, double th_energy) {
             vOrient3D(c3, c0, c1, oc) <= 0) return false;
     }
 
-    tet_node.resize(newsize);
-    tet_neigh.resize(newsize);
-    mark_tetrahedra.resize(newsize >> 2, mark_tetrahedra[t>>2]);
+    const uint64_t b2 = getFreeTetSlot();
+    mark_tetrahedra[b2 >> 2] = mark_tetrahedra[t >> 2];
+    if (new_tet != NULL) *new_tet = b2;
 
     uint32_t* tn = getTetNodes(t);
     *tn++ = c3; *tn++ = oc; *tn++ = c1; *tn++ = c2;
@@ -1210,7 +1844,7 @@ bool TetMesh::swapFace(uint64_t r, bool prevent_inversion, double th_energy) {
     tn = getTetNodes(b2);
     *tn++ = c3; *tn++ = c0; *tn++ = c1; *tn++ = oc;
 
-    uint64_t* tg = getTetNeighs(t);
+    corner_t* tg = getTetNeighs(t);
     *tg++ = g10; *tg++ = g00; *tg++ = opp + 1; *tg++ = b2 + 1;
     tg = getTetNeighs(opp);
     *tg++ = g11; *tg++ = t + 2; *tg++ = g01; *tg++ = b2 + 2;
@@ -1356,7 +1990,8 @@ bool TetMesh::collapseOnV1(uint32_t v1, uint32_t v2, bool prevent_inversion, dou
 vector3d getFaceCenter(const TetMesh& tin, uint64_t c) {
     uint32_t v1, v2, fv[3];
     tin.getFaceVertices(c, fv);
-    std::vector<uint64_t> et;
+    static thread_local std::vector<uint64_t> et; // Static to avoid reallocation at each call
+    et.clear();
     int usev[3] = { 0, 0, 0 };
     size_t t;
 
@@ -1382,31 +2017,33 @@ vector3d getFaceCenter(const TetMesh& tin, uint64_t c) {
 
 void TetMesh::splitEdge(uint32_t ev0, uint32_t ev1, uint32_t v) {
     uint64_t itt=UINT64_MAX;
-    static std::vector<uint64_t> et;
+    static thread_local std::vector<uint64_t> et;
     et.clear();
     ETcorners(ev0, ev1, et);
 
     for (uint64_t i : et) if (!isGhost(i>>2)) { itt = i>>2; break; }
 
-    size_t first = numTets();
-    resizeTets(first + et.size());
+    // New tets are built in recycled slots when available, hence
+    // they are not necessarily contiguous in the arrays.
+    static thread_local std::vector<uint64_t> slots;
+    slots.resize(et.size());
+    for (size_t i = 0; i < et.size(); i++) slots[i] = getFreeTetSlot();
 
-    first <<= 2;
-    size_t cur = first;
     for (size_t i = 0; i < et.size(); i++) {
         const uint64_t tb = et[i] & (~3);
+        const uint64_t cur = slots[i];
         if ((tb >> 2) == itt) itt = (cur >> 2);
         uint32_t* tn = tet_node.data() + tb;
         uint64_t tncv;
         mark_tetrahedra[cur >> 2] = mark_tetrahedra[tb >> 2];
-        for (int j = 0; j < 4; j++) tet_node[cur++] = (tn[j] != ev1) ? (tn[j]) : (v);
-        for (int j = 0; j < 4; j++) 
-            if (tn[j] == ev0) tn[j] = v; 
+        for (int j = 0; j < 4; j++) tet_node[cur + j] = (tn[j] != ev1) ? (tn[j]) : (v);
+        for (int j = 0; j < 4; j++)
+            if (tn[j] == ev0) tn[j] = v;
             else if (tn[j] == ev1) tncv = tet_neigh[tb + j];
 
-        const uint64_t c0 = tetCornerAtVertex(cur -4, ev0);
+        const uint64_t c0 = tetCornerAtVertex(cur, ev0);
         const uint64_t c1 = tetCornerAtVertex(tb, ev1);
-        const uint64_t cv = tetCornerAtVertex(cur - 4, v);
+        const uint64_t cv = tetCornerAtVertex(cur, v);
         setMutualNeighbors(cv, tncv);
         setMutualNeighbors(c0, c1);
     }
@@ -1414,20 +2051,21 @@ void TetMesh::splitEdge(uint32_t ev0, uint32_t ev1, uint32_t v) {
     for (size_t i = 0; i < et.size(); i++) {
         const size_t next = (i + 1) % (et.size());
         const size_t nnext = (i + 2) % (et.size());
-        const uint64_t c0 = first + (i<<2) + (et[i] & 3);
-        const uint32_t ov = tet_node[first + (nnext << 2) + (et[nnext] & 3)];
-        const uint64_t c1 = tetCornerAtVertex(first + (next << 2), ov);
+        const uint64_t c0 = slots[i] + (et[i] & 3);
+        const uint32_t ov = tet_node[slots[nnext] + (et[nnext] & 3)];
+        const uint64_t c1 = tetCornerAtVertex(slots[next], ov);
         setMutualNeighbors(c0, c1);
     }
 
     inc_tet[ev0] = itt;
-    for (uint64_t t = numTets() - 1; t > 0; t--) if (!isGhost(t)) {
-        inc_tet[v] = t; break;
+    for (uint64_t s : slots) if (!isGhost(s >> 2)) {
+        inc_tet[v] = s >> 2; break;
     }
 }
 
 double TetMesh::maxEnergyAtEdge(uint32_t v1, uint32_t v2) const {
-    std::vector<uint64_t> etf;
+    static thread_local std::vector<uint64_t> etf; // Static to avoid reallocation at each call
+    etf.clear();
     ETfull(v1, v2, etf);
 
     double pre_energy = 0.0;
@@ -1455,7 +2093,8 @@ double TetMesh::maxEnergyAtFace(uint64_t t) const {
 }
 
 double TetMesh::maxEnergyAtVertex(uint32_t v) const {
-    std::vector<uint64_t> vt;
+    static thread_local std::vector<uint64_t> vt; // Static to avoid reallocation at each call
+    vt.clear();
     VT(v, vt);
     double e = 0.0;
     for (uint64_t t : vt) {
@@ -1478,7 +2117,7 @@ bool TetMesh::removeEdge(uint32_t v1, uint32_t v2, double pre_energy) {
     splitEdge(v1, v2, newv);
 
     bool succeeds = false;
-    static std::vector<uint32_t> vv;
+    static thread_local std::vector<uint32_t> vv;
     VV(newv, vv);
 
     for (uint32_t w : vv) if (w != v1 && w != v2 && collapseOnV1(w, newv, true, pre_energy)) {
@@ -1522,6 +2161,113 @@ void TetMesh::removeDelVertices() {
     vertices.resize(last);
     inc_tet.resize(last);
     marked_vertex.resize(last);
+
+    // Vertices have been renumbered: the grids are stale
+    loc_grid.clear();
+    loc_grid_built_verts = 0;
+    enc_grid.clear();
+}
+
+uint32_t TetMesh::insertVertices(const double* coords, uint32_t num_v) {
+    const uint32_t first = numVertices();
+    vertices.reserve(first + num_v);
+    v_arena.reserve(num_v);
+    for (uint32_t i = 0; i < num_v; i++)
+        pushVertex(v_arena.create(coords[i * 3], coords[i * 3 + 1], coords[i * 3 + 2]));
+
+    // New points may fall outside the current bounding box
+    setStaticFilterBounds();
+
+    // The cavity expansion of insertExistingVertex() uses mark_tetrahedra as
+    // scratch and requires every reachable tet to be zero on entry, while a
+    // characterized mesh carries DT_IN/DT_OUT labels there: save the labels
+    // for the whole batch and clear them (slots queued for deletion keep
+    // their delete bit and are skipped by the expansion as usual)
+    static thread_local std::vector<uint32_t> saved_marks; // Static to avoid reallocation at each call
+    saved_marks.assign(mark_tetrahedra.begin(), mark_tetrahedra.end());
+    for (uint64_t t = 0; t < numTets(); t++)
+        if (!isToDelete(t << 2)) mark_tetrahedra[t] = 0;
+
+    // Any live tet works as the initial hint for the walk
+    uint64_t ct = UINT64_MAX;
+    for (uint32_t v = 0; v < first && ct == UINT64_MAX; v++)
+        if (inc_tet[v] != UINT64_MAX) ct = inc_tet[v] << 2;
+
+    for (uint32_t vi = first; vi < first + num_v; vi++) {
+        const uint64_t gt = getApproximateStartingTet(vi);
+        if (gt != UINT64_MAX) ct = gt;
+        insertExistingVertex(vi, ct);
+    }
+
+    // Restore the labels of the surviving original tets. Every tet rebuilt by
+    // the insertions has one of the new vertices as a node: those are left
+    // DT_UNKNOWN (ghosts DT_OUT) for reconcileIncrementalUpdate() to repair
+    for (uint64_t t = 0; t < numTets(); t++) {
+        if (isToDelete(t << 2)) continue;
+        const uint32_t* tn = tet_node.data() + t * 4;
+        if (tn[0] >= first || tn[1] >= first || tn[2] >= first || tn[3] >= first)
+            mark_tetrahedra[t] = (isGhost(t)) ? DT_OUT : DT_UNKNOWN;
+        else mark_tetrahedra[t] = saved_marks[t];
+    }
+
+    return first;
+}
+
+uint32_t TetMesh::removeVertices(const uint32_t* vtx, uint32_t num_v) {
+    static thread_local std::vector<uint32_t> vv; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint64_t> vt;
+    uint32_t num_removed = 0;
+
+    for (uint32_t i = 0; i < num_v; i++) {
+        const uint32_t v = vtx[i];
+        if (v >= numVertices() || inc_tet[v] == UINT64_MAX) continue;
+        vv.clear();
+        VV(v, vv);
+        for (uint32_t w : vv) if (collapseOnV1(w, v, true)) {
+            num_removed++;
+            // The tets reshaped by the collapse are those incident at w
+            vt.clear();
+            VTfull(w, vt);
+            for (uint64_t t : vt) mark_tetrahedra[t] = (isGhost(t)) ? DT_OUT : DT_UNKNOWN;
+            break;
+        }
+    }
+
+    return num_removed;
+}
+
+void TetMesh::reconcileIncrementalUpdate(const std::vector<bool>* cornerMask) {
+    // Repair the unknown marks before compacting, while a caller-provided
+    // cornerMask still matches the current corner numbering. Slots queued
+    // for deletion keep their delete bit, hence they are never DT_UNKNOWN
+    // and never seed nor receive a label here.
+    std::vector<uint64_t> C;
+    for (uint64_t t = 0; t < numTets(); t++)
+        if (!isToDelete(t << 2) && mark_tetrahedra[t] != DT_UNKNOWN)
+            for (int j = 0; j < 4; j++)
+                if (mark_tetrahedra[tet_neigh[t * 4 + j] >> 2] == DT_UNKNOWN) {
+                    C.push_back(t);
+                    break;
+                }
+
+    for (size_t i = 0; i < C.size(); i++) {
+        const uint64_t t = C[i];
+        for (int j = 0; j < 4; j++) {
+            const uint64_t n = tet_neigh[t * 4 + j];
+            const uint64_t n2 = n >> 2;
+            if (mark_tetrahedra[n2] == DT_UNKNOWN) {
+                if (cornerMask && (*cornerMask)[n])
+                    mark_tetrahedra[n2] = ((mark_tetrahedra[t] == DT_IN) ? (DT_OUT) : (DT_IN));
+                else
+                    mark_tetrahedra[n2] = mark_tetrahedra[t];
+                C.push_back(n2);
+            }
+        }
+    }
+
+    // Single deferred compaction for the whole batch of updates
+    removeManyDelTets();
+    removeDelVertices();
 }
 
 class edgeWithLength {
@@ -1576,7 +2322,8 @@ void TetMesh::boundaryETcorners(uint32_t v1, uint32_t v2, std::vector<uint64_t>&
 
 // Fill 'bvt' with boundary faces incident at v
 void TetMesh::boundaryVTcorners(uint32_t v, std::vector<uint64_t>& bvt) const {
-    std::vector<uint64_t> vt;
+    static thread_local std::vector<uint64_t> vt; // Static to avoid reallocation at each call
+    vt.clear();
     VTfull(v, vt);
     for (uint64_t t : vt) for (int i = 0; i < 4; i++) {
         const uint64_t c = (t << 2) + i;
@@ -1587,7 +2334,8 @@ void TetMesh::boundaryVTcorners(uint32_t v, std::vector<uint64_t>& bvt) const {
 
 // VV relation restricted to incident boundary triangles
 void TetMesh::boundaryVV(uint32_t v, std::vector<uint32_t>& bvv) const {
-    std::vector<uint64_t> vt;
+    static thread_local std::vector<uint64_t> vt; // Static to avoid reallocation at each call
+    vt.clear();
     VTfull(v, vt);
     for (uint64_t t : vt) for (int i = 0; i < 4; i++) {
         const uint64_t c = (t << 2) + i;
@@ -1603,10 +2351,12 @@ void TetMesh::boundaryVV(uint32_t v, std::vector<uint32_t>& bvv) const {
 }
 
 bool TetMesh::isDoubleFlatV2(uint32_t v1, uint32_t v2) const {
-    std::vector<uint64_t> et;
+    static thread_local std::vector<uint64_t> et; // Static to avoid reallocation at each call
+    et.clear();
     boundaryETcorners(v1, v2, et);
 
-    std::vector<uint32_t> ov(et.size());
+    static thread_local std::vector<uint32_t> ov;
+    ov.resize(et.size());
     uint32_t v[3];
     for (size_t i = 0; i < et.size(); i++) {
         getFaceVertices(et[i], v);
@@ -1614,7 +2364,8 @@ bool TetMesh::isDoubleFlatV2(uint32_t v1, uint32_t v2) const {
     }
 
     // Now 'ov' contains opposite vertices of all boundary triangles incident at v1-v2
-    std::vector<uint32_t> vv;
+    static thread_local std::vector<uint32_t> vv;
+    vv.clear();
     boundaryVV(v2, vv);
 
     for (uint32_t w : ov) marked_vertex[w] |= 128;
@@ -1637,29 +2388,78 @@ size_t TetMesh::iterativelySwapMesh(double th_energy) {
     std::vector<std::pair<uint32_t, uint32_t>> all_edges; // All the non-infinite mesh edges
     getMeshEdges(all_edges);
 
-    std::vector< edgeWithLength> ets;
+    // Longest-first worklist: edges whose surroundings are rebuilt by a
+    // successful removal are re-scored and re-enqueued right away instead
+    // of waiting for a further full-mesh pass.
+    std::priority_queue<edgeWithLength> wl;
     for (auto& e : all_edges) if (!isOnBoundary(e.first, e.second)) {
         const vector3d v[2] = { vector3d(vertices[e.first]), vector3d(vertices[e.second]) };
-        ets.push_back(edgeWithLength(e.first, e.second, (v[0].dist_sq(v[1]))));
+        wl.push(edgeWithLength(e.first, e.second, (v[0].dist_sq(v[1]))));
     }
-    std::sort(ets.begin(), ets.end());
 
     size_t swapped_edges = 0;
-    for (size_t i = ets.size(); i > 0; i--) {
-        const edgeWithLength& e = ets[i - 1];
+    static thread_local std::vector<uint64_t> et; // Static to avoid reallocation at each call
+    static thread_local std::vector<uint32_t> star, vv;
+    while (!wl.empty()) {
+        const edgeWithLength e = wl.top();
+        wl.pop();
         const double pre_energy = maxEnergyAtEdge(e.v1, e.v2);
-        if (pre_energy >= th_energy && removeEdge(e.v1, e.v2, pre_energy)) swapped_edges++;
+        if (pre_energy < th_energy) continue;
+
+        // Vertices delimiting the region that a removal would rebuild
+        et.clear(); star.clear();
+        ETfull(e.v1, e.v2, et);
+        for (uint64_t t : et) {
+            const uint32_t* n = tet_node.data() + (t << 2);
+            for (int i = 0; i < 4; i++) if (n[i] != INFINITE_VERTEX) star.push_back(n[i]);
+        }
+
+        if (!removeEdge(e.v1, e.v2, pre_energy)) continue;
+        swapped_edges++;
+
+        // Only the tets refilling the star changed: re-score the edges
+        // connecting its vertices
+        std::sort(star.begin(), star.end());
+        star.erase(std::unique(star.begin(), star.end()), star.end());
+        for (uint32_t u : star) {
+            vv.clear();
+            VV(u, vv);
+            for (uint32_t w : vv)
+                if (u < w && std::binary_search(star.begin(), star.end(), w) && !isOnBoundary(u, w)) {
+                    const vector3d p[2] = { vector3d(vertices[u]), vector3d(vertices[w]) };
+                    wl.push(edgeWithLength(u, w, p[0].dist_sq(p[1])));
+                }
+        }
     }
 
     removeManyDelTets();
 
     size_t swapped_faces = 0;
-    for (size_t t = 0; t < tet_node.size(); t++) {
+    std::vector<uint64_t> fwl; // Corners to revisit after a successful swap
+    const auto rescoreAround = [this, &fwl](uint64_t tb) {
+        for (int i = 0; i < 4; i++) { fwl.push_back(tb + i); fwl.push_back(tet_neigh[tb + i]); }
+    };
+    const auto trySwapFace = [&](uint64_t t) {
         const uint64_t tb = t >> 2, nb = tet_neigh[t] >> 2;
         if (!isGhost(tb) && !isGhost(nb) && mark_tetrahedra[tb] == mark_tetrahedra[nb]) {
             const double pre_energy = maxEnergyAtFace(t);
-            if (pre_energy >= th_energy && swapFace(t, true, pre_energy)) swapped_faces++;
+            const uint64_t opp = tet_neigh[t] & (~3);
+            uint64_t b2;
+            if (pre_energy >= th_energy && swapFace(t, true, pre_energy, &b2)) {
+                swapped_faces++;
+                // Only the three tets replacing the swapped pair changed:
+                // revisit their faces and the faces they bound
+                rescoreAround(t & (~3));
+                rescoreAround(opp);
+                rescoreAround(b2);
+            }
         }
+    };
+    for (size_t t = 0; t < tet_node.size(); t++) trySwapFace(t);
+    while (!fwl.empty()) {
+        const uint64_t t = fwl.back();
+        fwl.pop_back();
+        trySwapFace(t);
     }
 
     return swapped_edges + swapped_faces;
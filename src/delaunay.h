@@ -16,6 +16,29 @@
 #define DT_OUT  1
 #define DT_IN  2
 
+// Uncommenting the following macro definition halves the memory taken by
+// the adjacency array: corner references are stored as 32-bit values, so
+// traversals touch half the cache lines, but the mesh cannot exceed
+// 2^30 tets (resizeTets() aborts when the limit is hit).
+// #define USE_32BIT_ADJACENCY
+
+#ifdef USE_32BIT_ADJACENCY
+typedef uint32_t corner_t;
+#define INVALID_CORNER UINT32_MAX
+#else
+typedef uint64_t corner_t;
+#define INVALID_CORNER UINT64_MAX
+#endif
+
+// Thresholds for the multi-threaded point location used by tetrahedrize().
+// Meshes below these sizes are built with the plain sequential loop.
+#define PAR_LOCATE_MIN_VERTICES 100000
+#define PAR_LOCATE_MIN_TETS 50000
+#define PAR_LOCATE_BATCH_SIZE 16384
+
+// Minimum mesh size for the parallel flood-fill in markInnerTets()
+#define PAR_FLOOD_MIN_TETS 100000
+
 #define MARKBIT(m, twoPowBit) m |= ((uint32_t)twoPowBit)
 #define UNMARKBIT(m, twoPowBit) m &= (~((uint32_t)twoPowBit))
 #define ISMARKEDBIT(m, twoPowBit) m & ((uint32_t)twoPowBit) 
@@ -28,15 +51,64 @@
 // This will make the code slightly slower (from 1% to 3% depending on the cases).
 // #define USE_MAROTS_METHOD
 
+/// <summary>
+/// explicitPointArena
+/// Contiguous storage for the explicit input points.
+/// Points are packed in a few large blocks so that predicate operands
+/// stream from contiguous memory during the insertion loop instead of
+/// chasing one heap allocation per vertex.
+/// Blocks are never relocated, hence pointers returned by create()
+/// remain valid for the whole life of the arena.
+/// </summary>
+
+class explicitPointArena {
+    std::vector<std::pair<const explicitPoint*, const explicitPoint*>> blocks; // [begin, end) of each block, sorted by address
+    explicitPoint* next = nullptr; // First unused element in the newest block
+    const explicitPoint* block_end = nullptr; // End of the newest block
+
+    static constexpr size_t BLOCK_SIZE = 16384; // Num points per block when the size is not known in advance
+
+    void addBlock(size_t size) {
+        explicitPoint* b = (explicitPoint*)malloc(sizeof(explicitPoint) * size);
+        next = b;
+        block_end = b + size;
+        const std::pair<const explicitPoint*, const explicitPoint*> r(b, b + size);
+        blocks.insert(std::upper_bound(blocks.begin(), blocks.end(), r), r);
+    }
+
+public:
+    explicitPointArena() {}
+    explicitPointArena(const explicitPointArena&) = delete;
+    ~explicitPointArena() { for (auto& b : blocks) free((void*)b.first); }
+
+    // Make room for at least 'n' further points (existing blocks are untouched)
+    void reserve(size_t n) { if ((size_t)(block_end - next) < n) addBlock(n); }
+
+    // Build a new point in the arena
+    explicitPoint* create(double x, double y, double z) {
+        if (next == block_end) addBlock(BLOCK_SIZE);
+        return new (next++) explicitPoint(x, y, z);
+    }
+
+    // TRUE if p was allocated by this arena
+    bool owns(const pointType* p) const {
+        auto i = std::upper_bound(blocks.begin(), blocks.end(), (const explicitPoint*)p,
+            [](const explicitPoint* q, const std::pair<const explicitPoint*, const explicitPoint*>& b) { return q < b.first; });
+        return i != blocks.begin() && (--i)->second > (const explicitPoint*)p;
+    }
+};
+
+
 // Tetrahedral mesh data structure
 
 class TetMesh {
 public:
   // General purpose fields
   std::vector<pointType*> vertices; // Vertices
+  explicitPointArena v_arena; // Contiguous storage for the explicit input points
   std::vector<uint64_t> inc_tet; // One tet incident upon each vertex
   std::vector<uint32_t> tet_node; // Tet corners
-  std::vector<uint64_t> tet_neigh; // Tet opposites
+  std::vector<corner_t> tet_neigh; // Tet opposites (see USE_32BIT_ADJACENCY)
   mutable std::vector<uint32_t> mark_tetrahedra; // Marks on tets
   mutable std::vector<unsigned char> marked_vertex; // Marks on vertices
 
@@ -46,6 +118,22 @@ public:
 
   std::vector<uint64_t> Del_deleted;
 
+  // Uniform-grid point locator (see getApproximateStartingTet())
+  std::vector<uint32_t> loc_grid; // Each cell stores one representative vertex
+  double loc_grid_origin[3] = { 0.0, 0.0, 0.0 }; // Min corner of the gridded box
+  double loc_grid_inv_step = 0.0; // Inverse of the cell side
+  uint32_t loc_grid_res = 0; // Number of cells per side
+  uint32_t loc_grid_built_verts = 0; // numVertices() at the last rebuild
+
+  // Uniform grid over the vertices answering the diametral-sphere range
+  // queries of findEncroachingPoint(). Unlike loc_grid, cells keep full
+  // per-vertex lists: pushVertex() appends to them once the grid has been
+  // built, removeDelVertices() drops the grid since vertices are renumbered.
+  std::vector<std::vector<uint32_t>> enc_grid;
+  double enc_grid_origin[3] = { 0.0, 0.0, 0.0 }; // Min corner of the gridded box
+  double enc_grid_inv_step = 0.0; // Inverse of the cell side
+  uint32_t enc_grid_res = 0; // Number of cells per side
+
   const bool has_outer_vertices; // This is TRUE if mesh vertices must survive after destruction
 
   // Constructor and destructor
@@ -70,8 +158,15 @@ public:
   // Fill the vertex vector with newly-created genericPoints
   void init_vertices(const double* coords, uint32_t num_v);
 
-  // Destroy vertices
-  void flushVertices() { for (pointType* p : vertices) delete p; }
+  // Compute per-mesh suprema of the error bounds used by the filtered
+  // orient3d/inSphere kernels, so that most of their calls resolve with a
+  // single comparison. Must be re-invoked whenever the mesh bounding box
+  // may have grown. Bounds are thread local: each thread covers the last
+  // mesh it initialized, worker threads fall back to the dynamic filters.
+  void setStaticFilterBounds() const;
+
+  // Destroy vertices (points owned by the arena are freed with it)
+  void flushVertices() { for (pointType* p : vertices) if (!v_arena.owns(p)) delete p; }
 
   // Init the mesh with a tet connecting four non coplanar points in vertices
   void init(uint32_t& unswap_k, uint32_t& unswap_l);
@@ -90,6 +185,16 @@ public:
   // As above, but uses a binary format to avoid rounding
   bool saveBinaryTET(const char* filename, bool inner_only = false) const;
 
+  // Dump the whole structure (vertices, connectivity, marks) to a binary
+  // snapshot file. Differently from the save* functions above, no
+  // information is lost: loadSnapshot() rebuilds a mesh which is
+  // indistinguishable from the one that was saved, so that the subsequent
+  // pipeline stages can restart from there instead of recomputing.
+  // Implicit (LNC) vertices are stored as references to their endpoints,
+  // hence coordinates stay exact across a save/load cycle.
+  bool saveSnapshot(const char* filename) const;
+  bool loadSnapshot(const char* filename);
+
   // Save the interface between DT_IN and DT_OUT as an OFF file
   bool saveBoundaryToOFF(const char* filename) const;
 
@@ -107,6 +212,31 @@ public:
   // Clear deleted vertices after removal
   void removeDelVertices();
 
+  /////// Incremental updates ///////
+  //
+  // These functions update an existing (possibly characterized) mesh when
+  // a small fraction of the geometry changes, without re-tetrahedrizing
+  // from scratch. Tets rebuilt around the modified regions have their
+  // in/out marks reset to DT_UNKNOWN and deleted slots are only queued:
+  // call reconcileIncrementalUpdate() once after a batch of updates to
+  // repair the marks and compact the structure in a single pass.
+
+  // Insert 'num_v' new points (three doubles each in 'coords') into an
+  // existing tetrahedrization. Return the index of the first one.
+  uint32_t insertVertices(const double* coords, uint32_t num_v);
+
+  // Remove the given vertices by collapsing them onto a neighbor.
+  // Vertices whose removal would invert a tet or break the boundary are
+  // kept: the number of vertices actually removed is returned.
+  uint32_t removeVertices(const uint32_t* vtx, uint32_t num_v);
+
+  // Repair the tets left DT_UNKNOWN by the updates above by propagating
+  // the labels of their untouched neighbors, then compact the tet and
+  // vertex arrays. 'cornerMask', when given, must be TRUE for each corner
+  // whose opposite face is a constraint (as in markInnerTets), so that
+  // labels flip when the propagation front crosses a constraint.
+  void reconcileIncrementalUpdate(const std::vector<bool>* cornerMask = NULL);
+
   // Resize the whole structure to contain 'new_size' tets
   void resizeTets(uint64_t new_size);
   void reserveTets(uint64_t new_capacity);
@@ -135,7 +265,7 @@ public:
   uint64_t getCornerFromOppositeTet(uint64_t t, uint64_t n) const;
 
   // Return the i'th tet in neighbors 'n'
-  inline uint64_t getIthNeighbor(const uint64_t* n, const uint64_t i) const { return n[i] & (~3); }
+  inline uint64_t getIthNeighbor(const corner_t* n, const uint64_t i) const { return n[i] & (~3); }
 
   // Fill v with the three vertices of t	
   void getFaceVertices(uint64_t t, uint32_t v[3]) const;
@@ -159,9 +289,9 @@ public:
 
   // Direct pointer to nodes and neighs
   uint32_t* getTetNodes(uint64_t tet) { return tet_node.data() + tet; }
-  uint64_t* getTetNeighs(uint64_t tet) { return tet_neigh.data() + tet; }
+  corner_t* getTetNeighs(uint64_t tet) { return tet_neigh.data() + tet; }
   const uint32_t* getTetNodes(uint64_t tet) const { return tet_node.data() + tet; }
-  const uint64_t* getTetNeighs(uint64_t tet) const { return tet_neigh.data() + tet; }
+  const corner_t* getTetNeighs(uint64_t tet) const { return tet_neigh.data() + tet; }
 
   // tetNi is a sum modulo 3 - used to traverse the nodes of a tet
   static size_t tetN1(const size_t i) { return (i + 1) & 3; }
@@ -178,16 +308,49 @@ public:
       vertices.push_back(p);
       inc_tet.push_back(UINT64_MAX);
       marked_vertex.push_back(0);
+      if (!enc_grid.empty()) encGridInsert((uint32_t)vertices.size() - 1);
   }
 
   // Inserts an isolated vertex which is already in the vertices array.
   // ct is a hint for the algorithm to start searching the tet containing vi
   void insertExistingVertex(const uint32_t vi, uint64_t& ct);
 
+  // Same as above, usable only while every vertex in the mesh is explicit
+  // (e.g. the initial Delaunay tetrahedrization of the input points, but not
+  // the cavity meshes of faceRecovery, which may contain implicit Steiner
+  // points): predicates skip the per-point type dispatch.
+  void insertExistingVertexE(const uint32_t vi, uint64_t& ct);
+
+#ifndef USE_MAROTS_METHOD
+  template<bool ALL_EXPLICIT> void insertExistingVertexT(const uint32_t vi, uint64_t& ct);
+#endif
+
   // Starting from 'tet', move by adjacencies until a tet is found that
   // contains vi. Return that tet.
   uint64_t searchTetrahedron(uint64_t tet, const uint32_t v_id);
 
+  // As above, usable only while every vertex in the mesh is explicit
+  uint64_t searchTetrahedronE(uint64_t tet, const uint32_t v_id);
+
+  // Return a tet close to vertex v_id to be used as the starting point for
+  // the walk above, or UINT64_MAX if none is known. Relies on a uniform
+  // grid over the vertices which is lazily rebuilt as the mesh grows: each
+  // cell remembers one representative vertex, and the tet incident at the
+  // representative closest to v_id is returned. This turns the long walks
+  // triggered by far-away hints (e.g. during segment recovery) into a
+  // grid lookup followed by a few local steps.
+  uint64_t getApproximateStartingTet(const uint32_t v_id);
+
+  // Rebuild the locator grid from scratch (called lazily by the above)
+  void rebuildLocatorGrid();
+
+  // (Re)build the encroachment grid, and file one vertex into it
+  void rebuildEncroachmentGrid();
+  void encGridInsert(uint32_t v);
+  size_t encGridCell(const double* c) const;
+
+  template<bool ALL_EXPLICIT> uint64_t searchTetrahedronT(uint64_t tet, const uint32_t v_id);
+
   // Incident tetrahedra at a vertex
   void VT(uint32_t v, std::vector<uint64_t>& vt) const;
 
@@ -207,6 +370,11 @@ public:
   // TRUE if v1 and v2 are connected by an edge
   bool hasEdge(uint32_t v1, uint32_t v2) const;
 
+  // As above, but visited tets are tracked in a per-thread scratch rather
+  // than in the shared tet marks, so that many threads may query concurrently
+  // (e.g. the parallel missing-edge rescan in segmentRecovery_HSi())
+  bool hasEdgeThreadSafe(uint32_t v1, uint32_t v2) const;
+
   // Swap the position of t1 and t2 in the structure and update all relations accordingly
   void swapTets(const uint64_t t1, const uint64_t t2);
 
@@ -230,6 +398,22 @@ public:
   // for eventual deletion.
   void pushAndMarkDeletedTets(uint64_t c) { Del_deleted.push_back(c); markToDelete(c); }
 
+  // Return the base corner of a free tet slot where a new tet can be built.
+  // Slots queued in Del_deleted are recycled in place before the arrays are
+  // grown, so local operations keep an amortized O(1) cost and the expensive
+  // compaction of removeDelTets() is deferred to a single pass.
+  uint64_t getFreeTetSlot() {
+      if (!Del_deleted.empty()) {
+          const uint64_t c = Del_deleted.back();
+          Del_deleted.pop_back();
+          mark_tetrahedra[c >> 2] &= (~((uint32_t)1073741824));
+          return c;
+      }
+      const uint64_t c = tet_node.size();
+      resizeTets(numTets() + 1);
+      return c;
+  }
+
   // Predicates operating on vertex indexes
   int vOrient3D(uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4) const {
       return -pointType::orient3D(*vertices[v1], *vertices[v2], *vertices[v3], *vertices[v4]);
@@ -238,6 +422,35 @@ public:
       return -pointType::inSphere(*vertices[v1], *vertices[v2], *vertices[v3], *vertices[v4], *vertices[v5]);
   }
 
+  // As above, but valid only while every vertex in the mesh is explicit:
+  // raw coordinates feed the double kernels directly, with no type-tag
+  // dispatch per point.
+  int vOrient3D_E(uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4) const {
+      const double* p1 = vertices[v1]->toExplicit3D().ptr();
+      const double* p2 = vertices[v2]->toExplicit3D().ptr();
+      const double* p3 = vertices[v3]->toExplicit3D().ptr();
+      const double* p4 = vertices[v4]->toExplicit3D().ptr();
+      return -orient3d(p1[0], p1[1], p1[2], p2[0], p2[1], p2[2], p3[0], p3[1], p3[2], p4[0], p4[1], p4[2]);
+  }
+  int vInSphere_E(uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5) const {
+      const double* p1 = vertices[v1]->toExplicit3D().ptr();
+      const double* p2 = vertices[v2]->toExplicit3D().ptr();
+      const double* p3 = vertices[v3]->toExplicit3D().ptr();
+      const double* p4 = vertices[v4]->toExplicit3D().ptr();
+      const double* p5 = vertices[v5]->toExplicit3D().ptr();
+      return -inSphere(p1[0], p1[1], p1[2], p2[0], p2[1], p2[2], p3[0], p3[1], p3[2], p4[0], p4[1], p4[2], p5[0], p5[1], p5[2]);
+  }
+
+  // Compile-time selection between the generic and the explicit-only predicates
+  template<bool ALL_EXPLICIT> int vOrient3DT(uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4) const {
+      if constexpr (ALL_EXPLICIT) return vOrient3D_E(v1, v2, v3, v4);
+      else return vOrient3D(v1, v2, v3, v4);
+  }
+  template<bool ALL_EXPLICIT> int vInSphereT(uint32_t v1, uint32_t v2, uint32_t v3, uint32_t v4, uint32_t v5) const {
+      if constexpr (ALL_EXPLICIT) return vInSphere_E(v1, v2, v3, v4, v5);
+      else return vInSphere(v1, v2, v3, v4, v5);
+  }
+
   // Use the order of the five cospherical points in 'indices' to
   // return a nonzero though coherent inSphere result.
   int symbolicPerturbation(uint32_t indices[5]) const;
@@ -249,17 +462,22 @@ public:
   // Same as above, but the four vertices are the vertices of 'tet'.
   int vertexInTetSphere(uint64_t tet, uint32_t v_id) const;
 
+  // Explicit-only capable variants of the above
+  template<bool ALL_EXPLICIT> int vertexInTetSphereT(const uint32_t v[4], uint32_t v_id) const;
+  template<bool ALL_EXPLICIT> int vertexInTetSphereT(uint64_t tet, uint32_t v_id) const;
+
   // Collect all the vertices contained in the smallest sphere by ep0 and ep1
   // and return the one generating the largest circumcircle with ep0 and ep1.
-  // Init tet with one tet having the encroaching point
-  uint32_t findEncroachingPoint(const uint32_t ep0, const uint32_t ep1, uint64_t& tet) const;
+  // Init tet with one tet having the encroaching point.
+  // Non-const because the encroachment grid is built upon the first query.
+  uint32_t findEncroachingPoint(const uint32_t ep0, const uint32_t ep1, uint64_t& tet);
 
   // Start from c and turn around v1-v2 as long as adjacencies are well defined.
   // When an invalid adjacency is found, reinit it and exit.
-  void seekAndSetMutualAdjacency(int p_o0, int p_o1, int p_o2, const uint32_t* v, uint64_t c, uint64_t o, const uint32_t* tet_node_data, uint64_t* tet_neigh_data);
+  void seekAndSetMutualAdjacency(int p_o0, int p_o1, int p_o2, const uint32_t* v, uint64_t c, uint64_t o, const uint32_t* tet_node_data, corner_t* tet_neigh_data);
 
   // Rebuild internal adjacencies for the cavity tet opposite to c
-  void restoreLocalConnectivty(uint64_t c, const uint32_t* tet_node_data, uint64_t* tet_neigh_data);
+  void restoreLocalConnectivty(uint64_t c, const uint32_t* tet_node_data, corner_t* tet_neigh_data);
 
 #ifdef USE_MAROTS_METHOD
   class DelTmp {
@@ -314,7 +532,7 @@ public:
   void splitEdge(uint32_t ev0, uint32_t ev1, uint32_t v);
 
   // 2-3 swap
-  bool swapFace(uint64_t r, bool prevent_inversion, double min_energy = DBL_MAX);
+  bool swapFace(uint64_t r, bool prevent_inversion, double min_energy = DBL_MAX, uint64_t* new_tet = NULL);
 
   // Edge removal
   bool removeEdge(uint32_t v1, uint32_t v2, double min_energy = DBL_MAX);
@@ -326,13 +544,15 @@ public:
   void boundaryETcorners(uint32_t v1, uint32_t v2, std::vector<uint64_t>& bet) const;
 
   bool isOnBoundary(uint32_t v1, uint32_t v2) const {
-      std::vector<uint64_t> bet;
+      static thread_local std::vector<uint64_t> bet; // Static to avoid reallocation at each call
+      bet.clear();
       boundaryETcorners(v1, v2, bet);
       return !bet.empty();
   }
 
   bool isOnBoundary(uint32_t v) const {
-      std::vector<uint64_t> bvt;
+      static thread_local std::vector<uint64_t> bvt; // Static to avoid reallocation at each call
+      bvt.clear();
       boundaryVTcorners(v, bvt);
       return !bvt.empty();
   }
@@ -648,7 +648,7 @@ void TetMesh::connect_bnd_tri(const uint64_t bnd_tri, std::vector<uint64_t>& C_b
     const uint64_t tet_ind = numTets();
     mark_tetrahedra.push_back(0);
     tet_node.insert(tet_node.end(), { v[0],v[1],v[2],v3 });
-    tet_neigh.insert(tet_neigh.end(), { UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX });
+    tet_neigh.insert(tet_neigh.end(), { INVALID_CORNER, INVALID_CORNER, INVALID_CORNER, INVALID_CORNER });
 
     // update delmesh vrts -> incident tetrahedra RELATION
     inc_tet[v[0]] = tet_ind;
@@ -765,6 +765,8 @@ bool TetMesh::isLowerCavityTet(const uint64_t t, std::vector<int>& v_orient) con
 }
 
 void TetMesh::recoverFaceGiftWrap(std::vector<uint64_t>& i_tets, std::vector<int>& v_orient) {
+    CDT_STAT_INC(giftwrap_calls);
+
     if (marked_vertex.empty()) marked_vertex.resize(numVertices(), 0);
 
     // Create vector 'top_faces' and 'bottom_faces'
@@ -785,7 +787,7 @@ void TetMesh::recoverFaceGiftWrap(std::vector<uint64_t>& i_tets, std::vector<int
     last++; // This is now the numtets after having removed toremove
 
     for (uint64_t t : i_tets) {
-        const uint64_t* neigh = getTetNeighs(t << 2);
+        const corner_t* neigh = getTetNeighs(t << 2);
         for (int i = 0; i < 4; i++) if (!is_marked_Tet_1(neigh[i] >> 2)) {
             if (isUpperCavityTet(neigh[i], v_orient)) top_faces.push_back(neigh[i]);
             else {
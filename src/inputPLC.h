@@ -1,6 +1,13 @@
 #include <iostream>
 #include <fstream>
 
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using namespace std;
 
 class reVertex {
@@ -69,7 +76,7 @@ bool misAlignment(const double* p, const double* q, const double* r)
         orient2d(p[0], p[2], q[0], q[2], r[0], r[2]);
 }
 
-void read_OFF_file(const char* filename,
+void read_OFF_file_stdio(const char* filename,
     double** vertices_p, uint32_t* npts,
     uint32_t** tri_vertices_p, uint32_t* ntri, bool verbose) {
 
@@ -117,6 +124,136 @@ void read_OFF_file(const char* filename,
     fclose(file);
 }
 
+// Binary companion format for OFF files. The payload can be copied to the
+// input arrays with no text conversion at all:
+//   8 bytes  - magic "BINOFF01"
+//   uint32_t - number of points
+//   uint32_t - number of triangles
+//   doubles  - 3 coordinates per point
+//   uint32_t - 3 vertex indexes per triangle
+#define BINOFF_MAGIC "BINOFF01"
+#define BINOFF_MAGIC_LEN 8
+
+// Write vertices and triangles in the binary companion format
+bool write_BINOFF_file(const char* filename, const double* coords, uint32_t npts, const uint32_t* tri, uint32_t ntri) {
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL) return false;
+
+    fwrite(BINOFF_MAGIC, 1, BINOFF_MAGIC_LEN, file);
+    fwrite(&npts, sizeof(uint32_t), 1, file);
+    fwrite(&ntri, sizeof(uint32_t), 1, file);
+    fwrite(coords, sizeof(double) * 3, npts, file);
+    fwrite(tri, sizeof(uint32_t) * 3, ntri, file);
+    fclose(file);
+
+    return true;
+}
+
+// Parse an unsigned integer starting at 's' and move 's' past it
+static uint32_t parse_uint(const char*& s, const char* end) {
+    while (s < end && (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r')) s++;
+    uint32_t v = 0;
+    while (s < end && *s >= '0' && *s <= '9') v = v * 10 + (uint32_t)(*s++ - '0');
+    return v;
+}
+
+// Parse a double starting at 's' and move 's' past it.
+// strtod grants exactly-rounded results as fscanf("%lf") did; the buffer
+// copy near the end of the mapping avoids reading past it.
+static double parse_double(const char*& s, const char* end) {
+    while (s < end && (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r')) s++;
+    char* e;
+    if (end - s >= 64) {
+        const double v = strtod(s, &e);
+        s = e;
+        return v;
+    }
+    char buf[65];
+    const size_t n = end - s;
+    memcpy(buf, s, n);
+    buf[n] = '\0';
+    const double v = strtod(buf, &e);
+    s += (e - buf);
+    return v;
+}
+
+// Parse a whole OFF (or BINOFF) file already available in memory
+static void parse_OFF_buffer(const char* s, const char* end,
+    double** vertices_p, uint32_t* npts,
+    uint32_t** tri_vertices_p, uint32_t* ntri, bool verbose, const char* filename) {
+
+    if (end - s >= BINOFF_MAGIC_LEN && memcmp(s, BINOFF_MAGIC, BINOFF_MAGIC_LEN) == 0) {
+        s += BINOFF_MAGIC_LEN;
+        if (end - s < (ptrdiff_t)(sizeof(uint32_t) * 2)) ip_error("read_OFF_file: FATAL ERROR truncated binary input file\n");
+        memcpy(npts, s, sizeof(uint32_t)); s += sizeof(uint32_t);
+        memcpy(ntri, s, sizeof(uint32_t)); s += sizeof(uint32_t);
+        if (verbose) std::cout << "file " << filename << " contains " << *npts << " vertices and " << *ntri << " constraints (triangles)\n";
+
+        if (end - s < (ptrdiff_t)(sizeof(double) * 3 * (*npts) + sizeof(uint32_t) * 3 * (*ntri)))
+            ip_error("read_OFF_file: FATAL ERROR truncated binary input file\n");
+
+        *vertices_p = (double*)malloc(sizeof(double) * 3 * (*npts));
+        *tri_vertices_p = (uint32_t*)malloc(sizeof(uint32_t) * 3 * (*ntri));
+        memcpy(*vertices_p, s, sizeof(double) * 3 * (*npts)); s += sizeof(double) * 3 * (*npts);
+        memcpy(*tri_vertices_p, s, sizeof(uint32_t) * 3 * (*ntri));
+        return;
+    }
+
+    if (end - s < 3 || s[0] != 'O' || s[1] != 'F' || s[2] != 'F')
+        ip_error("read_OFF_file: FATAL ERROR "
+            "1st line of input file is different from OFF\n");
+    s += 3;
+
+    *npts = parse_uint(s, end);
+    *ntri = parse_uint(s, end);
+    parse_uint(s, end); // Number of edges (unused)
+
+    if (verbose) std::cout << "file " << filename << " contains " << *npts << " vertices and " << *ntri << " constraints (triangles)\n";
+
+    *vertices_p = (double*)malloc(sizeof(double) * 3 * (*npts));
+    *tri_vertices_p = (uint32_t*)malloc(sizeof(uint32_t) * 3 * (*ntri));
+
+    for (uint32_t i = 0; i < (*npts) * 3; i++)
+        (*vertices_p)[i] = parse_double(s, end);
+
+    for (uint32_t i = 0; i < (*ntri); i++) {
+        const uint32_t nv = parse_uint(s, end);
+        if (nv != 3) ip_error("Non-triangular faces not supported\n");
+        (*tri_vertices_p)[i * 3] = parse_uint(s, end);
+        (*tri_vertices_p)[i * 3 + 1] = parse_uint(s, end);
+        (*tri_vertices_p)[i * 3 + 2] = parse_uint(s, end);
+    }
+
+    if (s > end) ip_error("error reading input file\n");
+}
+
+// Map the input file in memory and parse it with direct pointer scanning:
+// per-token fscanf parsing dominated startup time on large inputs.
+// Falls back to the stdio reader when mapping is unavailable.
+void read_OFF_file(const char* filename,
+    double** vertices_p, uint32_t* npts,
+    uint32_t** tri_vertices_p, uint32_t* ntri, bool verbose) {
+
+#ifndef _MSC_VER
+    const int fd = open(filename, O_RDONLY);
+    if (fd >= 0) {
+        struct stat sb;
+        if (fstat(fd, &sb) == 0 && sb.st_size > 0) {
+            const char* data = (const char*)mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                parse_OFF_buffer(data, data + sb.st_size, vertices_p, npts, tri_vertices_p, ntri, verbose, filename);
+                munmap((void*)data, sb.st_size);
+                close(fd);
+                return;
+            }
+        }
+        close(fd);
+    }
+#endif
+
+    read_OFF_file_stdio(filename, vertices_p, npts, tri_vertices_p, ntri, verbose);
+}
+
 int vertex_compare(const void* void_v1, const void* void_v2)
 {
     const input_vertex_t* v1 = (input_vertex_t*)void_v1;
@@ -1,15 +1,33 @@
 #include <chrono>
+#include "cdt_stats.h"
 
 FILE* log_fp;
 std::chrono::steady_clock::time_point time_point;
 
+// Extra CSV columns emitted when the hot-path counters are compiled in
+#ifdef CDT_STATS
+#define CDT_STATS_CSV_HEADER ", O3d_Filtered, O3d_Exact, Isp_Filtered, Isp_Interval, Isp_Exact, " \
+    "Walks, Walk_Steps, Cavities, Cavity_Tets, GiftWrap_Calls"
+inline void logStats() {
+    fprintf(log_fp, ", %zu, %zu, %zu, %zu, %zu, %zu, %zu, %zu, %zu, %zu",
+        (size_t)cdt_stats.o3d_filtered, (size_t)cdt_stats.o3d_exact,
+        (size_t)cdt_stats.isp_filtered, (size_t)cdt_stats.isp_interval, (size_t)cdt_stats.isp_exact,
+        (size_t)cdt_stats.walks, (size_t)cdt_stats.walk_steps,
+        (size_t)cdt_stats.cavities, (size_t)cdt_stats.cavity_tets,
+        (size_t)cdt_stats.giftwrap_calls);
+}
+#else
+#define CDT_STATS_CSV_HEADER ""
+inline void logStats() {}
+#endif
+
 inline void startLogging(const char* fn) {
     if (fn != NULL) {
         log_fp = fopen("cdt_log.csv", "r");
         if (log_fp == NULL) {
             log_fp = fopen("cdt_log.csv", "w");
             fprintf(log_fp, "Input_File, Delaunay(ms), Segment_Rec(ms), Face_Rec(ms), "
-                "Erosion(ms), Memory(MB), Is_Polyhedron, Input_Verts, Input_Tris, Steiner, Tot_Tets, In_Tets, Flat_Tets, Flipped_Tets, Si's method works\n");
+                "Erosion(ms), Memory(MB), Is_Polyhedron, Input_Verts, Input_Tris, Steiner, Tot_Tets, In_Tets, Flat_Tets, Flipped_Tets, Si's method works" CDT_STATS_CSV_HEADER "\n");
         }
         else {
             fclose(log_fp);
@@ -24,7 +42,7 @@ inline void startLogging(const char* fn) {
     else {
         log_fp = stdout;
         fprintf(log_fp, " , Delaunay(ms), Segment_Rec(ms), Face_Rec(ms), "
-            "Erosion(ms), Memory(MB), Is_Polyhedron, Input_Verts, Input_Tris, Steiner, Tot_Tets, In_Tets, Flat_Tets, Flipped_Tets, Si's method works\n");
+            "Erosion(ms), Memory(MB), Is_Polyhedron, Input_Verts, Input_Tris, Steiner, Tot_Tets, In_Tets, Flat_Tets, Flipped_Tets, Si's method works" CDT_STATS_CSV_HEADER "\n");
     }
 
     time_point = std::chrono::steady_clock::now();
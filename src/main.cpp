@@ -4,6 +4,12 @@
 
 #include <iostream>
 #include <fstream>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "delaunay.h"
 #include "inputPLC.h"
 #include "PLC.h"
@@ -92,6 +98,7 @@ TetMesh* createSteinerCDT(inputPLC& plc, const char *options) {
 		logInteger((uint32_t)nflat);
 		logInteger((uint32_t)nflip);
 		logBoolean(sisMethodWorks);
+		logStats(); // No-op unless compiled with -DSTATS=ON
 		finishLogging();
 	}
 
@@ -168,6 +175,145 @@ bool saveOutputFile(TetMesh& tin, const char* filename, const char* options) {
 	return ret;
 }
 
+// processFile
+//
+// Runs the whole pipeline (load, CDT, save) on a single input file.
+// Returns false if either the input could not be read or the output
+// could not be written.
+
+bool processFile(const char* filename, const char* options) {
+	inputPLC plc;
+	if (!plc.initFromFile(filename, strchr(options, 'v') != NULL)) return false;
+
+	TetMesh* tin = createSteinerCDT(plc, options);
+	const bool ret = saveOutputFile(*tin, filename, options);
+	delete tin;
+	return ret;
+}
+
+// Bounded hand-off queue connecting the stages of the batch pipeline below.
+// push() blocks when the queue is full, pop() blocks until an item arrives
+// or the producer side is closed (in which case it returns false).
+
+template<class T> class boundedQueue {
+	std::deque<T> items;
+	const size_t capacity;
+	bool closed = false;
+	std::mutex m;
+	std::condition_variable not_empty, not_full;
+
+public:
+	boundedQueue(size_t cap) : capacity(cap) {}
+
+	void push(T v) {
+		std::unique_lock<std::mutex> l(m);
+		not_full.wait(l, [&]() { return items.size() < capacity; });
+		items.push_back(std::move(v));
+		not_empty.notify_one();
+	}
+
+	bool pop(T& v) {
+		std::unique_lock<std::mutex> l(m);
+		not_empty.wait(l, [&]() { return !items.empty() || closed; });
+		if (items.empty()) return false;
+		v = std::move(items.front());
+		items.pop_front();
+		not_full.notify_one();
+		return true;
+	}
+
+	void close() {
+		std::lock_guard<std::mutex> l(m);
+		closed = true;
+		not_empty.notify_all();
+	}
+};
+
+// batchProcessFiles
+//
+// Processes all the files listed (one per line) in 'listfilename' as a
+// three-stage pipeline: one reader thread parses the inputs, 'num_workers'
+// threads (all the available cores if zero) build the CDTs, one writer
+// thread serializes the results. The bounded queues between the stages let
+// the parse of job N+1 and the save of job N-1 overlap the triangulation
+// of job N, so disk and cores no longer strictly alternate.
+// Returns the number of files that could not be processed.
+
+uint32_t batchProcessFiles(const char* listfilename, const char* options, unsigned num_workers) {
+	std::vector<std::string> jobs;
+	std::ifstream list(listfilename);
+	if (!list) ip_error("batchProcessFiles: cannot open list file.\n");
+	std::string line;
+	while (std::getline(list, line)) {
+		while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.pop_back();
+		if (!line.empty()) jobs.push_back(line);
+	}
+	if (jobs.empty()) ip_error("batchProcessFiles: list file contains no filenames.\n");
+
+	if (num_workers == 0) num_workers = std::thread::hardware_concurrency();
+	if (num_workers > jobs.size()) num_workers = (unsigned)jobs.size();
+	if (num_workers == 0) num_workers = 1;
+
+	struct batchJob {
+		std::string filename;
+		inputPLC* plc = NULL;
+		TetMesh* tin = NULL;
+	};
+
+	// Parsed inputs and finished meshes are large: keep only a few in flight
+	boundedQueue<batchJob> parsed(num_workers + 1), meshed(2);
+	std::atomic<uint32_t> num_failed(0);
+
+	std::thread reader([&]() {
+		initFPU(); // The input dedup uses FP predicates
+		for (const std::string& filename : jobs) {
+			inputPLC* plc = new inputPLC;
+			if (plc->initFromFile(filename.c_str(), false)) {
+				parsed.push(batchJob{ filename, plc, NULL });
+			}
+			else {
+				delete plc;
+				num_failed.fetch_add(1);
+				printf("%s: FAILED\n", filename.c_str());
+			}
+		}
+		parsed.close();
+	});
+
+	std::thread writer([&]() {
+		initFPU();
+		batchJob job;
+		while (meshed.pop(job)) {
+			const bool ok = saveOutputFile(*job.tin, job.filename.c_str(), options);
+			delete job.tin;
+			if (!ok) num_failed.fetch_add(1);
+			printf("%s: %s\n", job.filename.c_str(), ok ? "done" : "FAILED");
+		}
+	});
+
+	auto worker = [&]() {
+		initFPU();
+		batchJob job;
+		while (parsed.pop(job)) {
+			job.tin = createSteinerCDT(*job.plc, options);
+			delete job.plc;
+			job.plc = NULL;
+			meshed.push(std::move(job));
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned t = 1; t < num_workers; t++) threads.emplace_back(worker);
+	worker();
+	for (auto& t : threads) t.join();
+	meshed.close();
+
+	reader.join();
+	writer.join();
+
+	return num_failed.load();
+}
+
 int main(int argc, char* argv[])
 {
 	initFPU();
@@ -188,6 +334,8 @@ int main(int argc, char* argv[])
 		std::cout << "-m: use MEDIT format instead of TET\n";
 		std::cout << "-r: remove outer tetrahedra from output (if input is closed)\n";
 		std::cout << "-s: saves skin to an ASCII OFF file (triangles between IN and OUT)\n";
+		std::cout << "--batch listfile: process all the files listed (one per line) in listfile\n";
+		std::cout << "-j N: use N concurrent workers in batch mode (default: all cores)\n";
 		std::cout << "OUTPUT:\n";
 		std::cout << "Output has same name (and path) as input with an extension appended.\n";
 		std::cout << "E.g. CDT my_dir/test.off produces my_dir/test.off.tet\n";
@@ -198,20 +346,33 @@ int main(int argc, char* argv[])
 	char filename[2048] = "..\\Input_file\\bracket.off";
 
 	std::string options = "";
+	const char* batch_list = NULL;
+	unsigned num_workers = 0;
 
 	for (int i = 1; i < argc; i++)
-		if (argv[i][0] == '-') {
+		if (!strcmp(argv[i], "--batch") && i + 1 < argc) batch_list = argv[++i];
+		else if (!strcmp(argv[i], "-j") && i + 1 < argc) num_workers = (unsigned)atoi(argv[++i]);
+		else if (argv[i][0] == '-') {
 			for (int j = 1; j < strlen(argv[i]); j++) options += argv[i][j];
 		}
 		else memcpy(filename, argv[i], strlen(argv[i])+1);
 
-	// Load a valid PLC from file
-	inputPLC plc;
-	plc.initFromFile(filename, options.find('v') != std::string::npos);
+	if (batch_list != NULL) {
+		// The logger and the on-screen progress reports keep global state
+		// and are meaningless with interleaved outputs: disable them here.
+		size_t p;
+		while ((p = options.find_first_of("lwv")) != std::string::npos) {
+			printf("Batch mode: ignoring option '%c'\n", options[p]);
+			options.erase(p, 1);
+		}
 
-	TetMesh* tin = createSteinerCDT(plc, options.c_str());
+		const uint32_t num_failed = batchProcessFiles(batch_list, options.c_str(), num_workers);
+		if (num_failed == 0) printf("Finished\n");
+		else printf("Finished with %u failed files\n", num_failed);
+		return (num_failed != 0);
+	}
 
-	if (saveOutputFile(*tin, filename, options.c_str()))
+	if (processFile(filename, options.c_str()))
 		printf("Finished\n");
 
 	return 0;